@@ -0,0 +1,74 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_DIRECT_INVOCATION_H
+#define ICE_DIRECT_INVOCATION_H
+
+#include <Ice/Config.h>
+
+#ifdef ICE_CPP11_MAPPING
+
+#include <tuple>
+
+namespace IceInternal
+{
+
+//
+// The parameters of a synchronous twoway invocation which are passed
+// directly to a collocated servant instead of being marshaled in the
+// request, see Ice.CollocationDirect. The generated skeleton of the
+// servant gets them with Incoming::startDirectParams and writes the
+// results in the invocation. Servants which can't use them read the
+// parameters from the request as usual, the parameters are marshaled
+// on demand.
+//
+// These classes are only used by the generated code, which instantiates
+// them and must therefore see them, they aren't part of the Ice API. The
+// state of the invocation is kept by the Ice run time.
+//
+class ICE_API DirectInvocation
+{
+public:
+
+    virtual ~DirectInvocation();
+};
+
+template<typename R>
+class DirectResult : public DirectInvocation
+{
+public:
+
+    R result;
+};
+
+template<>
+class DirectResult<void> : public DirectInvocation
+{
+};
+
+//
+// The in-parameters are referenced, the servant gets copies of them.
+//
+template<typename R, typename... P>
+class DirectInvocationT : public DirectResult<R>
+{
+public:
+
+    DirectInvocationT(const P&... p) : params(p...)
+    {
+    }
+
+    const std::tuple<const P&...> params;
+};
+
+}
+
+#endif
+
+#endif
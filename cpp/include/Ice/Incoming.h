@@ -52,6 +52,11 @@ protected:
 namespace IceInternal
 {
 
+#ifdef ICE_CPP11_MAPPING
+class DirectInvocation;
+class DirectInvocationState;
+#endif
+
 class ICE_API IncomingBase : private IceUtil::noncopyable
 {
 public:
@@ -165,13 +170,30 @@ public:
 
     void invoke(const ServantManagerPtr&, Ice::InputStream*);
 
+#ifdef ICE_CPP11_MAPPING
+    void setDirectInvocation(DirectInvocationState*);
+
+    //
+    // Returns the parameters of a direct invocation or null if the
+    // parameters must be read from the request.
+    //
+    DirectInvocation* startDirectParams();
+    void endDirectParams();
+#endif
+
     // Inlined for speed optimization.
     void skipReadParams()
     {
+#ifdef ICE_CPP11_MAPPING
+        marshalDirectParams();
+#endif
         _current.encoding = _is->skipEncapsulation();
     }
     Ice::InputStream* startReadParams()
     {
+#ifdef ICE_CPP11_MAPPING
+        marshalDirectParams();
+#endif
         //
         // Remember the encoding used by the input parameters, we'll
         // encode the response parameters with the same encoding.
@@ -185,10 +207,16 @@ public:
     }
     void readEmptyParams()
     {
+#ifdef ICE_CPP11_MAPPING
+        marshalDirectParams();
+#endif
         _current.encoding = _is->skipEmptyEncapsulation();
     }
     void readParamEncaps(const Ice::Byte*& v, Ice::Int& sz)
     {
+#ifdef ICE_CPP11_MAPPING
+        marshalDirectParams();
+#endif
         _current.encoding = _is->readEncapsulation(v, sz);
     }
 
@@ -196,6 +224,14 @@ private:
 
     friend class IncomingAsync;
 
+#ifdef ICE_CPP11_MAPPING
+    //
+    // Marshal the parameters of the direct invocation dispatched by this
+    // request, if any, for the servant to read them from the request.
+    //
+    void marshalDirectParams();
+#endif
+
     Ice::InputStream* _is;
     Ice::Byte* _inParamPos;
 
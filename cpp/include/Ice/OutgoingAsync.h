@@ -23,6 +23,7 @@
 #include <Ice/ObserverHelper.h>
 #include <Ice/LocalException.h>
 #include <Ice/UniquePtr.h>
+#include <Ice/DirectInvocation.h>
 
 #ifndef ICE_CPP11_MAPPING
 #    include <Ice/AsyncResult.h>
@@ -265,7 +266,15 @@ public:
 #ifdef ICE_CPP11_MAPPING
     void invoke(const std::string&, Ice::OperationMode, Ice::FormatType, const Ice::Context&,
                 std::function<void(Ice::OutputStream*)>);
+    void invoke(const std::string&, Ice::OperationMode, Ice::FormatType, const Ice::Context&,
+                std::function<void(Ice::OutputStream*)>, DirectInvocation*);
     void throwUserException();
+
+    //
+    // Returns the direct invocation holding the results of the servant,
+    // or null if the results must be read from the response.
+    //
+    DirectInvocation* getDirectResult() const;
 #endif
 
     Ice::OutputStream* startWriteParams(Ice::FormatType format)
@@ -406,7 +415,8 @@ public:
            Ice::FormatType format,
            const Ice::Context& ctx,
            std::function<void(Ice::OutputStream*)> write,
-           std::function<void(const Ice::UserException&)> userException)
+           std::function<void(const Ice::UserException&)> userException,
+           DirectResult<T>* direct = nullptr)
     {
         _read = [](Ice::InputStream* stream)
         {
@@ -415,7 +425,7 @@ public:
             return v;
         };
         _userException = std::move(userException);
-        OutgoingAsync::invoke(operation, mode, format, ctx, std::move(write));
+        OutgoingAsync::invoke(operation, mode, format, ctx, std::move(write), direct);
     }
 
     void
@@ -425,15 +435,32 @@ public:
            const Ice::Context& ctx,
            std::function<void(Ice::OutputStream*)> write,
            std::function<void(const Ice::UserException&)> userException,
-           std::function<T(Ice::InputStream*)> read)
+           std::function<T(Ice::InputStream*)> read,
+           DirectResult<T>* direct = nullptr)
     {
         _read = std::move(read);
         _userException = std::move(userException);
-        OutgoingAsync::invoke(operation, mode, format, ctx, std::move(write));
+        OutgoingAsync::invoke(operation, mode, format, ctx, std::move(write), direct);
     }
 
 protected:
 
+    T
+    readResult()
+    {
+        DirectInvocation* direct = _synchronous ? getDirectResult() : nullptr;
+        if(direct)
+        {
+            return std::move(static_cast<DirectResult<T>*>(direct)->result);
+        }
+
+        assert(_read);
+        _is.startEncapsulation();
+        T v = _read(&_is);
+        _is.endEncapsulation();
+        return v;
+    }
+
     std::function<T(Ice::InputStream*)> _read;
 };
 
@@ -450,10 +477,11 @@ public:
            Ice::FormatType format,
            const Ice::Context& ctx,
            std::function<void(Ice::OutputStream*)> write,
-           std::function<void(const Ice::UserException&)> userException)
+           std::function<void(const Ice::UserException&)> userException,
+           DirectResult<void>* direct = nullptr)
     {
         _userException = std::move(userException);
-        OutgoingAsync::invoke(operation, mode, format, ctx, std::move(write));
+        OutgoingAsync::invoke(operation, mode, format, ctx, std::move(write), direct);
     }
 };
 
@@ -476,10 +504,7 @@ public:
             }
             else if(response)
             {
-                assert(this->_read);
-                this->_is.startEncapsulation();
-                R v = this->_read(&this->_is);
-                this->_is.endEncapsulation();
+                R v = this->readResult();
                 try
                 {
                     response(std::move(v));
@@ -581,10 +606,7 @@ public:
         {
             if(ok)
             {
-                assert(this->_read);
-                this->_is.startEncapsulation();
-                R v = this->_read(&this->_is);
-                this->_is.endEncapsulation();
+                R v = this->readResult();
                 this->_promise.set_value(v);
             }
             else
@@ -119,10 +119,29 @@ public:
     // Changes made to this value have no effect on existing connections.
     //
     virtual SSL_CTX* getContext() = 0;
-
 };
 ICE_DEFINE_PTR(PluginPtr, Plugin);
 
+//
+// The OpenSSL plug-in also implements this interface, use dynamic_cast
+// on the plug-in to obtain it.
+//
+class ICESSL_OPENSSL_API SessionCacheStats
+{
+public:
+
+    virtual ~SessionCacheStats();
+
+    //
+    // Obtain the number of outgoing and incoming connections whose TLS
+    // session was resumed (hits) or newly negotiated (misses) since the
+    // plug-in was initialized. Both are zero unless IceSSL.SessionCache
+    // is enabled.
+    //
+    virtual Ice::Long getSessionCacheHits() const = 0;
+    virtual Ice::Long getSessionCacheMisses() const = 0;
+};
+
 } // OpenSSL namespace end
 
 } // IceSSL namespace end
@@ -18,6 +18,13 @@
 #include <set>
 #include <map>
 
+namespace IceInternal
+{
+
+class TimerWheel;
+
+}
+
 namespace IceUtil
 {
 
@@ -60,6 +67,8 @@ public:
     //
     Timer(int priority);
 
+    virtual ~Timer();
+
     //
     // Destroy the timer and detach its execution thread if the calling thread
     // is the timer thread, join the timer execution thread otherwise.
@@ -90,55 +99,13 @@ protected:
     virtual void run();
     virtual void runTimerTask(const TimerTaskPtr&);
 
-    struct Token
-    {
-        IceUtil::Time scheduledTime;
-        IceUtil::Time delay;
-        TimerTaskPtr task;
-
-        inline Token(const IceUtil::Time&, const IceUtil::Time&, const TimerTaskPtr&);
-        inline bool operator<(const Token& r) const;
-    };
-
     IceUtil::Monitor<IceUtil::Mutex> _monitor;
     bool _destroyed;
-    std::set<Token> _tokens;
-
-    class TimerTaskCompare : public std::binary_function<TimerTaskPtr, TimerTaskPtr, bool>
-    {
-    public:
-
-        bool operator()(const TimerTaskPtr& lhs, const TimerTaskPtr& rhs) const
-        {
-            return lhs.get() < rhs.get();
-        }
-    };
-    std::map<TimerTaskPtr, IceUtil::Time, TimerTaskCompare> _tasks;
+    IceInternal::TimerWheel* _wheel;
     IceUtil::Time _wakeUpTime;
 };
 typedef IceUtil::Handle<Timer> TimerPtr;
 
-inline
-Timer::Token::Token(const IceUtil::Time& st, const IceUtil::Time& d, const TimerTaskPtr& t) :
-    scheduledTime(st), delay(d), task(t)
-{
-}
-
-inline bool
-Timer::Token::operator<(const Timer::Token& r) const
-{
-    if(scheduledTime < r.scheduledTime)
-    {
-        return true;
-    }
-    else if(scheduledTime > r.scheduledTime)
-    {
-        return false;
-    }
-
-    return task.get() < r.task.get();
-}
-
 }
 
 #endif
@@ -81,7 +81,7 @@ IceInternal::FactoryACMMonitor::~FactoryACMMonitor()
 {
     assert(!_instance);
     assert(_connections.empty());
-    assert(_changes.empty());
+    assert(_deadlines.empty());
     assert(_reapedConnections.empty());
 }
 
@@ -113,7 +113,6 @@ IceInternal::FactoryACMMonitor::destroy()
     }
 
     _instance = 0;
-    _changes.clear();
 
     //
     // Wait for the connection set to be cleared by the timer thread.
@@ -133,15 +132,9 @@ IceInternal::FactoryACMMonitor::add(const ConnectionIPtr& connection)
     }
 
     Lock sync(*this);
-    if(_connections.empty())
-    {
-        _connections.insert(connection);
-        _instance->timer()->scheduleRepeated(ICE_SHARED_FROM_THIS, _config.timeout / 2);
-    }
-    else
-    {
-        _changes.push_back(make_pair(connection, true));
-    }
+    assert(_connections.find(connection) == _connections.end());
+    _connections.insert(make_pair(connection, _deadlines.end()));
+    addDeadline(connection, IceUtil::Time::now(IceUtil::Time::Monotonic) + _config.timeout / 2);
 }
 
 void
@@ -154,7 +147,15 @@ IceInternal::FactoryACMMonitor::remove(const ConnectionIPtr& connection)
 
     Lock sync(*this);
     assert(_instance);
-    _changes.push_back(make_pair(connection, false));
+    map<ConnectionIPtr, DeadlineMap::iterator>::iterator p = _connections.find(connection);
+    if(p != _connections.end())
+    {
+        if(p->second != _deadlines.end())
+        {
+            _deadlines.erase(p->second);
+        }
+        _connections.erase(p);
+    }
 }
 
 void
@@ -164,6 +165,46 @@ IceInternal::FactoryACMMonitor::reap(const ConnectionIPtr& connection)
     _reapedConnections.push_back(connection);
 }
 
+void
+IceInternal::FactoryACMMonitor::check(const ConnectionIPtr& connection)
+{
+    if(_config.timeout == IceUtil::Time())
+    {
+        return;
+    }
+
+    Lock sync(*this);
+    if(!_instance)
+    {
+        return;
+    }
+
+    //
+    // The connection started a dispatch or an invocation, monitor it
+    // at the next (timeout / 4) period unless it's already due sooner.
+    // Its deadline might be the idle timeout or it might have no
+    // deadline at all, in which case a heartbeat on dispatch or the
+    // invocation timeout would be missed.
+    //
+    map<ConnectionIPtr, DeadlineMap::iterator>::iterator p = _connections.find(connection);
+    if(p == _connections.end())
+    {
+        return;
+    }
+
+    IceUtil::Time deadline = IceUtil::Time::now(IceUtil::Time::Monotonic) + _config.timeout / 4;
+    if(p->second != _deadlines.end())
+    {
+        if(p->second->first <= deadline)
+        {
+            return;
+        }
+        _deadlines.erase(p->second);
+        p->second = _deadlines.end();
+    }
+    addDeadline(connection, deadline);
+}
+
 ACMMonitorPtr
 IceInternal::FactoryACMMonitor::acm(const IceUtil::Optional<int>& timeout,
                                     const IceUtil::Optional<Ice::ACMClose>& close,
@@ -208,57 +249,133 @@ IceInternal::FactoryACMMonitor::swapReapedConnections(vector<ConnectionIPtr>& co
 void
 IceInternal::FactoryACMMonitor::runTimerTask()
 {
+    vector<ConnectionIPtr> connections;
+    IceUtil::Time now;
     {
         Lock sync(*this);
         if(!_instance)
         {
+            _deadlines.clear();
             _connections.clear();
             notifyAll();
             return;
         }
 
-        for(vector<pair<ConnectionIPtr, bool> >::const_iterator p = _changes.begin(); p != _changes.end(); ++p)
-        {
-            if(p->second)
-            {
-                _connections.insert(p->first);
-            }
-            else
-            {
-                _connections.erase(p->first);
-            }
-        }
-        _changes.clear();
+        _next = IceUtil::Time();
+        now = IceUtil::Time::now(IceUtil::Time::Monotonic);
 
-        if(_connections.empty())
+        DeadlineMap::iterator p;
+        for(p = _deadlines.begin(); p != _deadlines.end() && p->first <= now; ++p)
         {
-            _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
-            return;
+            connections.push_back(p->second);
+            _connections[p->second] = _deadlines.end();
         }
+        _deadlines.erase(_deadlines.begin(), p);
     }
 
     //
     // Monitor connections outside the thread synchronization, so
     // that connections can be added or removed during monitoring.
     //
-    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
-    for(set<ConnectionIPtr>::const_iterator p = _connections.begin(); p != _connections.end(); ++p)
+    vector<IceUtil::Time> deadlines;
+    deadlines.reserve(connections.size());
+    for(vector<ConnectionIPtr>::const_iterator p = connections.begin(); p != connections.end(); ++p)
     {
         try
         {
-            (*p)->monitor(now, _config);
+            deadlines.push_back((*p)->monitor(now, _config));
         }
         catch(const exception& ex)
         {
             handleException(ex);
+            deadlines.push_back(now + _config.timeout / 2);
         }
         catch(...)
         {
             handleException();
+            deadlines.push_back(now + _config.timeout / 2);
+        }
+    }
+
+    Lock sync(*this);
+    if(!_instance)
+    {
+        return; // The timer task is scheduled again by destroy() to clear the connections.
+    }
+
+    for(vector<ConnectionIPtr>::size_type i = 0; i < connections.size(); ++i)
+    {
+        //
+        // Skip the connection if it was removed or if it doesn't need to
+        // be monitored until the next dispatch or invocation.
+        //
+        map<ConnectionIPtr, DeadlineMap::iterator>::iterator p = _connections.find(connections[i]);
+        if(p == _connections.end() || deadlines[i] == IceUtil::Time())
+        {
+            continue;
+        }
+
+        //
+        // The connection might have been notified by a dispatch or an
+        // invocation while it was monitored, keep the earliest deadline.
+        //
+        if(p->second != _deadlines.end())
+        {
+            if(p->second->first <= deadlines[i])
+            {
+                continue;
+            }
+            _deadlines.erase(p->second);
+        }
+        p->second = _deadlines.insert(make_pair(deadlines[i], connections[i]));
+    }
+
+    if(!_deadlines.empty())
+    {
+        //
+        // Don't run the timer task more than once per (timeout / 8)
+        // period, the connections that are due within the period are
+        // monitored together.
+        //
+        IceUtil::Time next = max(_deadlines.begin()->first, now + _config.timeout / 8);
+        if(_next == IceUtil::Time() || next < _next)
+        {
+            scheduleTimerTask(next);
         }
     }
 }
 
+void
+IceInternal::FactoryACMMonitor::addDeadline(const ConnectionIPtr& connection, const IceUtil::Time& deadline)
+{
+    //
+    // Must be called with the lock held and with a connection without
+    // deadline. The deadlines are mostly added in increasing order so
+    // the end of the map is used as insertion hint.
+    //
+    map<ConnectionIPtr, DeadlineMap::iterator>::iterator p = _connections.find(connection);
+    assert(p != _connections.end() && p->second == _deadlines.end());
+    p->second = _deadlines.insert(_deadlines.end(), make_pair(deadline, connection));
+    if(_next == IceUtil::Time() || deadline < _next)
+    {
+        scheduleTimerTask(deadline);
+    }
+}
+
+void
+IceInternal::FactoryACMMonitor::scheduleTimerTask(const IceUtil::Time& time)
+{
+    //
+    // Always cancel the timer task, even if _next is cleared: the task
+    // might have been scheduled again by a connection notification
+    // after the timer thread dequeued it but before runTimerTask()
+    // cleared _next.
+    //
+    _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+    _next = time;
+    _instance->timer()->schedule(ICE_SHARED_FROM_THIS, time - IceUtil::Time::now(IceUtil::Time::Monotonic));
+}
+
 void
 FactoryACMMonitor::handleException(const exception& ex)
 {
@@ -327,6 +444,15 @@ IceInternal::ConnectionACMMonitor::reap(const ConnectionIPtr& connection)
     _parent->reap(connection);
 }
 
+void
+IceInternal::ConnectionACMMonitor::check(const ConnectionIPtr&)
+{
+    //
+    // Nothing to do, the connection is monitored every (timeout / 2)
+    // period.
+    //
+}
+
 ACMMonitorPtr
 IceInternal::ConnectionACMMonitor::acm(const IceUtil::Optional<int>& timeout,
                                        const IceUtil::Optional<Ice::ACMClose>& close,
@@ -19,7 +19,7 @@
 #include <Ice/InstanceF.h>
 #include <Ice/PropertiesF.h>
 #include <Ice/LoggerF.h>
-#include <set>
+#include <map>
 
 namespace IceInternal
 {
@@ -43,6 +43,7 @@ public:
     virtual void add(const Ice::ConnectionIPtr&) = 0;
     virtual void remove(const Ice::ConnectionIPtr&) = 0;
     virtual void reap(const Ice::ConnectionIPtr&) = 0;
+    virtual void check(const Ice::ConnectionIPtr&) = 0;
 
     virtual ACMMonitorPtr acm(const IceUtil::Optional<int>&,
                               const IceUtil::Optional<Ice::ACMClose>&,
@@ -63,6 +64,7 @@ public:
     virtual void add(const Ice::ConnectionIPtr&);
     virtual void remove(const Ice::ConnectionIPtr&);
     virtual void reap(const Ice::ConnectionIPtr&);
+    virtual void check(const Ice::ConnectionIPtr&);
 
     virtual ACMMonitorPtr acm(const IceUtil::Optional<int>&,
                               const IceUtil::Optional<Ice::ACMClose>&,
@@ -80,11 +82,22 @@ private:
 
     virtual void runTimerTask();
 
+    void addDeadline(const Ice::ConnectionIPtr&, const IceUtil::Time&);
+    void scheduleTimerTask(const IceUtil::Time&);
+
     InstancePtr _instance;
     const ACMConfig _config;
 
-    std::vector<std::pair<Ice::ConnectionIPtr, bool> > _changes;
-    std::set<Ice::ConnectionIPtr> _connections;
+    //
+    // The connections are indexed by the time at which they need to be
+    // monitored again, the timer task only monitors the connections that
+    // are due. A connection without deadline is either being monitored
+    // or waits for a dispatch or an invocation to be monitored again.
+    //
+    typedef std::multimap<IceUtil::Time, Ice::ConnectionIPtr> DeadlineMap;
+    DeadlineMap _deadlines;
+    std::map<Ice::ConnectionIPtr, DeadlineMap::iterator> _connections;
+    IceUtil::Time _next; // The time at which the timer task is scheduled, zero if not scheduled.
     std::vector<Ice::ConnectionIPtr> _reapedConnections;
 };
 
@@ -102,6 +115,7 @@ public:
     virtual void add(const Ice::ConnectionIPtr&);
     virtual void remove(const Ice::ConnectionIPtr&);
     virtual void reap(const Ice::ConnectionIPtr&);
+    virtual void check(const Ice::ConnectionIPtr&);
 
     virtual ACMMonitorPtr acm(const IceUtil::Optional<int>&,
                               const IceUtil::Optional<Ice::ACMClose>&,
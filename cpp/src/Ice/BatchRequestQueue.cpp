@@ -11,6 +11,7 @@
 #include <Ice/Instance.h>
 #include <Ice/Properties.h>
 #include <Ice/Reference.h>
+#include <Ice/LocalException.h>
 
 using namespace std;
 using namespace Ice;
@@ -64,15 +65,38 @@ private:
     const int _size;
 };
 
+class AutoFlushTimerTask : public IceUtil::TimerTask
+{
+public:
+
+    AutoFlushTimerTask(const BatchRequestQueuePtr& queue, const Ice::ObjectPrxPtr& proxy) :
+        _queue(queue), _proxy(proxy)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        _queue->autoFlush(this, _proxy);
+    }
+
+private:
+
+    const BatchRequestQueuePtr _queue;
+    const Ice::ObjectPrxPtr _proxy;
+};
+
 }
 
 BatchRequestQueue::BatchRequestQueue(const InstancePtr& instance, bool datagram) :
     _interceptor(instance->initializationData().batchRequestInterceptor),
+    _instance(instance),
     _batchStream(instance.get(), Ice::currentProtocolEncoding),
     _batchStreamInUse(false),
     _batchStreamCanFlush(false),
     _batchCompress(false),
-    _batchRequestNum(0)
+    _batchRequestNum(0),
+    _flushDelay(instance->batchAutoFlushDelay())
 {
     _batchStream.writeBlob(requestBatchHdr, sizeof(requestBatchHdr));
     _batchMarker = _batchStream.b.size();
@@ -152,6 +176,24 @@ BatchRequestQueue::finishBatchRequest(OutputStream* os,
         _batchStream.resize(_batchMarker);
         _batchStreamInUse = false;
         _batchStreamCanFlush = false;
+
+        //
+        // Flush the batch once the auto flush delay elapsed after the
+        // first request queued in the batch.
+        //
+        if(_flushDelay > 0 && _batchRequestNum > 0 && !_flushTask)
+        {
+            try
+            {
+                IceUtil::TimerTaskPtr task = ICE_MAKE_SHARED(AutoFlushTimerTask, this, proxy);
+                _instance->timer()->schedule(task, IceUtil::Time::microSeconds(_flushDelay));
+                _flushTask = task;
+            }
+            catch(const Ice::CommunicatorDestroyedException&)
+            {
+                // Ignore.
+            }
+        }
         notifyAll();
     }
     catch(const std::exception&)
@@ -196,6 +238,23 @@ BatchRequestQueue::swap(OutputStream* os, bool& compress)
         _batchStream.b.resize(_batchMarker);
     }
 
+    //
+    // The batch is flushed, cancel its auto flush. The next request
+    // queued in the batch schedules a new one.
+    //
+    if(_flushTask)
+    {
+        try
+        {
+            _instance->timer()->cancel(_flushTask);
+        }
+        catch(const Ice::CommunicatorDestroyedException&)
+        {
+            // Ignore.
+        }
+        _flushTask = ICE_NULLPTR;
+    }
+
     int requestNum = _batchRequestNum;
     _batchStream.swap(*os);
     compress = _batchCompress;
@@ -253,3 +312,33 @@ BatchRequestQueue::enqueueBatchRequest(const Ice::ObjectPrxPtr& proxy)
     _batchMarker = _batchStream.b.size();
     ++_batchRequestNum;
 }
+
+void
+BatchRequestQueue::autoFlush(const IceUtil::TimerTask* task, const Ice::ObjectPrxPtr& proxy)
+{
+    {
+        Lock sync(*this);
+        if(_flushTask.get() != task)
+        {
+            return; // The batch was flushed and the task canceled while it was about to run.
+        }
+        _flushTask = ICE_NULLPTR;
+        if(_exception || _batchRequestNum == 0)
+        {
+            return; // The batch was already flushed or the connection is closed.
+        }
+    }
+
+    try
+    {
+#ifdef ICE_CPP11_MAPPING
+        proxy->ice_flushBatchRequestsAsync();
+#else
+        proxy->begin_ice_flushBatchRequests();
+#endif
+    }
+    catch(const Ice::LocalException&)
+    {
+        // Ignore, the requests of the batch are lost like with a failed flush.
+    }
+}
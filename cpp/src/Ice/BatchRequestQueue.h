@@ -13,6 +13,7 @@
 #include <IceUtil/Shared.h>
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
+#include <IceUtil/Timer.h>
 #include <Ice/UniquePtr.h>
 
 #include <Ice/BatchRequestInterceptor.h>
@@ -40,6 +41,8 @@ public:
 
     void enqueueBatchRequest(const Ice::ObjectPrxPtr&);
 
+    void autoFlush(const IceUtil::TimerTask*, const Ice::ObjectPrxPtr&);
+
 private:
 
     void waitStreamInUse(bool);
@@ -49,6 +52,7 @@ private:
 #else
     Ice::BatchRequestInterceptorPtr _interceptor;
 #endif
+    const InstancePtr _instance;
     Ice::OutputStream _batchStream;
     bool _batchStreamInUse;
     bool _batchStreamCanFlush;
@@ -57,6 +61,8 @@ private:
     size_t _batchMarker;
     IceInternal::UniquePtr<Ice::LocalException> _exception;
     size_t _maxSize;
+    const Ice::Int _flushDelay;
+    IceUtil::TimerTaskPtr _flushTask;
 };
 
 };
@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Buffer.h>
+#include <Ice/BufferPool.h>
 #include <Ice/LocalException.h>
 
 using namespace std;
@@ -88,7 +89,7 @@ IceInternal::Buffer::Container::~Container()
 {
     if(_buf && _owned)
     {
-        ::free(_buf);
+        deallocateBuffer(_buf, _capacity);
     }
 }
 
@@ -107,7 +108,7 @@ IceInternal::Buffer::Container::clear()
 {
     if(_buf && _owned)
     {
-        ::free(_buf);
+        deallocateBuffer(_buf, _capacity);
     }
 
     _buf = 0;
@@ -135,14 +136,24 @@ IceInternal::Buffer::Container::reserve(size_type n)
         return;
     }
 
+    //
+    // Small buffers are allocated from the buffer pool with a power of
+    // two capacity, there's nothing to do if the capacity is unchanged.
+    //
+    _capacity = getBufferCapacity(_capacity);
+    if(_capacity == c && _owned)
+    {
+        return;
+    }
+
     pointer p;
     if(_owned)
     {
-        p = reinterpret_cast<pointer>(::realloc(_buf, _capacity));
+        p = reinterpret_cast<pointer>(reallocateBuffer(_buf, c, _capacity, _size));
     }
     else
     {
-        p = reinterpret_cast<pointer>(::malloc(_capacity));
+        p = reinterpret_cast<pointer>(allocateBuffer(_capacity));
         if(p)
         {
             ::memcpy(p, _buf, _size);
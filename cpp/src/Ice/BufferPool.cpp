@@ -0,0 +1,484 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/BufferPool.h>
+#include <IceUtil/Mutex.h>
+
+#include <vector>
+#include <set>
+#include <cstring>
+#include <stdlib.h>
+
+#if !defined(_WIN32)
+#   include <pthread.h>
+#endif
+
+using namespace std;
+using namespace IceInternal;
+
+extern "C" void iceBufferPoolThreadDestructor(void*);
+
+namespace
+{
+
+const size_t minCapacity = 256;
+const size_t maxPooledCapacity = 64 * 1024;
+const int sizeClassCount = 9; // 256B, 512B, ..., 64KB
+
+//
+// The number of buffers moved at once between a thread cache and the
+// shared pool.
+//
+const size_t transferCount = 8;
+
+const size_t defaultThreadCacheSize = 256 * 1024;
+const size_t defaultPoolSize = 4 * 1024 * 1024;
+
+int
+getSizeClass(size_t capacity)
+{
+    assert(capacity >= minCapacity && capacity <= maxPooledCapacity);
+    int sizeClass = 0;
+    while((minCapacity << sizeClass) < capacity)
+    {
+        ++sizeClass;
+    }
+    assert((minCapacity << sizeClass) == capacity);
+    return sizeClass;
+}
+
+struct FreeLists
+{
+    FreeLists() : size(0)
+    {
+    }
+
+    vector<void*> buffers[sizeClassCount];
+    size_t size;
+};
+
+class SharedPool : public IceUtil::Mutex
+{
+public:
+
+    SharedPool() :
+        threadCacheSize(defaultThreadCacheSize),
+        maxSize(defaultPoolSize),
+        allocations(0),
+        hits(0),
+        destroyed(false)
+    {
+    }
+
+    //
+    // Add the buffer to the pool if it's not full, free it otherwise.
+    // Must be called with the mutex locked.
+    //
+    void
+    release(void* buffer, int sizeClass)
+    {
+        size_t capacity = minCapacity << sizeClass;
+        if(!destroyed && freeLists.size + capacity <= maxSize)
+        {
+            freeLists.buffers[sizeClass].push_back(buffer);
+            freeLists.size += capacity;
+        }
+        else
+        {
+            ::free(buffer);
+        }
+    }
+
+    //
+    // Compute the limits from the limits configured by the
+    // communicators and free the buffers exceeding the new pool size.
+    // Must be called with the mutex locked.
+    //
+    void
+    updateLimits()
+    {
+        threadCacheSize = threadCacheSizes.empty() ? defaultThreadCacheSize : *threadCacheSizes.rbegin();
+        maxSize = destroyed ? 0 : (poolSizes.empty() ? defaultPoolSize : *poolSizes.rbegin());
+
+        //
+        // The thread caches are trimmed the next time they use the pool.
+        //
+        for(int i = sizeClassCount - 1; i >= 0 && freeLists.size > maxSize; --i)
+        {
+            vector<void*>& buffers = freeLists.buffers[i];
+            while(!buffers.empty() && freeLists.size > maxSize)
+            {
+                ::free(buffers.back());
+                buffers.pop_back();
+                freeLists.size -= minCapacity << i;
+            }
+        }
+    }
+
+    FreeLists freeLists;
+    size_t threadCacheSize;
+    size_t maxSize;
+    multiset<size_t> threadCacheSizes;
+    multiset<size_t> poolSizes;
+    Ice::Long allocations;
+    Ice::Long hits;
+    bool destroyed;
+};
+
+struct ThreadCache
+{
+    ThreadCache(size_t sz) : maxSize(sz), allocations(0), hits(0)
+    {
+    }
+
+    FreeLists freeLists;
+    size_t maxSize;
+    Ice::Long allocations;
+    Ice::Long hits;
+};
+
+//
+// Set once by the static initialization below and never deleted.
+//
+SharedPool* pool = 0;
+
+#if !defined(ICE_OS_UWP)
+bool hasKey = false;
+#   if defined(_WIN32)
+DWORD key;
+#   else
+pthread_key_t key;
+#   endif
+#endif
+
+class Init
+{
+public:
+
+    Init()
+    {
+        pool = new SharedPool;
+#if defined(_WIN32) && !defined(ICE_OS_UWP)
+        key = TlsAlloc();
+        hasKey = key != TLS_OUT_OF_INDEXES;
+#elif !defined(_WIN32)
+        hasKey = pthread_key_create(&key, &iceBufferPoolThreadDestructor) == 0;
+#endif
+    }
+
+    ~Init()
+    {
+#if !defined(ICE_OS_UWP)
+        if(hasKey)
+        {
+            //
+            // Release the cache of this thread, the caches of the
+            // threads still running are no longer released on thread
+            // exit once the key is deleted.
+            //
+            hasKey = false;
+#   if defined(_WIN32)
+            iceBufferPoolThreadDestructor(TlsGetValue(key));
+            TlsFree(key);
+#   else
+            iceBufferPoolThreadDestructor(pthread_getspecific(key));
+            pthread_key_delete(key);
+#   endif
+        }
+#endif
+
+        //
+        // The shared pool isn't deleted since threads still running
+        // might use it. Its buffers are freed and the buffers released
+        // from now on are freed instead of being added to the pool.
+        //
+        IceUtil::Mutex::Lock sync(*pool);
+        pool->destroyed = true;
+        pool->updateLimits();
+    }
+};
+
+Init init;
+
+//
+// Move the allocation counters of the thread cache to the shared pool.
+// Must be called with the pool mutex locked.
+//
+void
+flushStats(ThreadCache* cache)
+{
+    pool->allocations += cache->allocations;
+    pool->hits += cache->hits;
+    cache->allocations = 0;
+    cache->hits = 0;
+}
+
+ThreadCache*
+getThreadCache()
+{
+#if defined(ICE_OS_UWP)
+    return 0;
+#else
+    if(!hasKey)
+    {
+        return 0;
+    }
+
+#   if defined(_WIN32)
+    ThreadCache* cache = static_cast<ThreadCache*>(TlsGetValue(key));
+#   else
+    ThreadCache* cache = static_cast<ThreadCache*>(pthread_getspecific(key));
+#   endif
+    if(!cache)
+    {
+        {
+            IceUtil::Mutex::Lock sync(*pool);
+            cache = new ThreadCache(pool->threadCacheSize);
+        }
+#   if defined(_WIN32)
+        if(!TlsSetValue(key, cache))
+#   else
+        if(pthread_setspecific(key, cache) != 0)
+#   endif
+        {
+            delete cache;
+            return 0;
+        }
+    }
+    return cache;
+#endif
+}
+
+void
+releaseThreadCache(ThreadCache* cache)
+{
+    {
+        IceUtil::Mutex::Lock sync(*pool);
+        flushStats(cache);
+        for(int i = 0; i < sizeClassCount; ++i)
+        {
+            for(vector<void*>::const_iterator p = cache->freeLists.buffers[i].begin();
+                p != cache->freeLists.buffers[i].end(); ++p)
+            {
+                pool->release(*p, i);
+            }
+        }
+    }
+    delete cache;
+}
+
+}
+
+extern "C" void iceBufferPoolThreadDestructor(void* v)
+{
+    if(v)
+    {
+        releaseThreadCache(static_cast<ThreadCache*>(v));
+    }
+}
+
+size_t
+IceInternal::getBufferCapacity(size_t size)
+{
+    if(size > maxPooledCapacity)
+    {
+        return size;
+    }
+
+    size_t capacity = minCapacity;
+    while(capacity < size)
+    {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+void*
+IceInternal::allocateBuffer(size_t capacity)
+{
+    if(capacity > maxPooledCapacity)
+    {
+        return ::malloc(capacity);
+    }
+
+    int sizeClass = getSizeClass(capacity);
+    ThreadCache* cache = getThreadCache();
+    if(cache)
+    {
+        ++cache->allocations;
+        vector<void*>& buffers = cache->freeLists.buffers[sizeClass];
+        if(buffers.empty())
+        {
+            //
+            // Get a batch of buffers from the shared pool.
+            //
+            IceUtil::Mutex::Lock sync(*pool);
+            flushStats(cache);
+            cache->maxSize = pool->threadCacheSize;
+
+            vector<void*>& shared = pool->freeLists.buffers[sizeClass];
+            size_t count = min(shared.size(), transferCount);
+            buffers.insert(buffers.end(), shared.end() - count, shared.end());
+            shared.resize(shared.size() - count);
+            pool->freeLists.size -= count * capacity;
+            cache->freeLists.size += count * capacity;
+        }
+
+        if(!buffers.empty())
+        {
+            ++cache->hits;
+            void* buffer = buffers.back();
+            buffers.pop_back();
+            cache->freeLists.size -= capacity;
+            return buffer;
+        }
+    }
+    else if(pool)
+    {
+        IceUtil::Mutex::Lock sync(*pool);
+        ++pool->allocations;
+        vector<void*>& shared = pool->freeLists.buffers[sizeClass];
+        if(!shared.empty())
+        {
+            ++pool->hits;
+            void* buffer = shared.back();
+            shared.pop_back();
+            pool->freeLists.size -= capacity;
+            return buffer;
+        }
+    }
+    return ::malloc(capacity);
+}
+
+void*
+IceInternal::reallocateBuffer(void* buffer, size_t oldCapacity, size_t capacity, size_t size)
+{
+    if(oldCapacity > maxPooledCapacity && capacity > maxPooledCapacity)
+    {
+        return ::realloc(buffer, capacity);
+    }
+
+    void* p = allocateBuffer(capacity);
+    if(p && buffer)
+    {
+        memcpy(p, buffer, min(size, capacity));
+        deallocateBuffer(buffer, oldCapacity);
+    }
+    return p;
+}
+
+void
+IceInternal::deallocateBuffer(void* buffer, size_t capacity)
+{
+    if(!buffer)
+    {
+        return;
+    }
+
+    if(capacity > maxPooledCapacity)
+    {
+        ::free(buffer);
+        return;
+    }
+
+    int sizeClass = getSizeClass(capacity);
+    ThreadCache* cache = getThreadCache();
+    if(cache)
+    {
+        vector<void*>& buffers = cache->freeLists.buffers[sizeClass];
+        if(cache->freeLists.size + capacity <= cache->maxSize)
+        {
+            buffers.push_back(buffer);
+            cache->freeLists.size += capacity;
+            return;
+        }
+
+        //
+        // The thread cache is full, move a batch of buffers to the
+        // shared pool.
+        //
+        IceUtil::Mutex::Lock sync(*pool);
+        flushStats(cache);
+        cache->maxSize = pool->threadCacheSize;
+
+        size_t count = min(buffers.size(), transferCount);
+        for(vector<void*>::const_iterator p = buffers.end() - count; p != buffers.end(); ++p)
+        {
+            pool->release(*p, sizeClass);
+        }
+        buffers.resize(buffers.size() - count);
+        cache->freeLists.size -= count * capacity;
+        pool->release(buffer, sizeClass);
+    }
+    else if(pool)
+    {
+        IceUtil::Mutex::Lock sync(*pool);
+        pool->release(buffer, sizeClass);
+    }
+    else
+    {
+        ::free(buffer); // Released before the pool is initialized.
+    }
+}
+
+void
+IceInternal::addBufferPoolLimits(size_t threadCacheSize, size_t poolSize)
+{
+    IceUtil::Mutex::Lock sync(*pool);
+    pool->threadCacheSizes.insert(threadCacheSize);
+    pool->poolSizes.insert(poolSize);
+    pool->updateLimits();
+}
+
+void
+IceInternal::removeBufferPoolLimits(size_t threadCacheSize, size_t poolSize)
+{
+    IceUtil::Mutex::Lock sync(*pool);
+    multiset<size_t>::iterator p = pool->threadCacheSizes.find(threadCacheSize);
+    if(p != pool->threadCacheSizes.end())
+    {
+        pool->threadCacheSizes.erase(p);
+    }
+    p = pool->poolSizes.find(poolSize);
+    if(p != pool->poolSizes.end())
+    {
+        pool->poolSizes.erase(p);
+    }
+    pool->updateLimits();
+}
+
+BufferPoolStats
+IceInternal::getBufferPoolStats()
+{
+    BufferPoolStats stats = BufferPoolStats();
+    ThreadCache* cache = getThreadCache();
+    IceUtil::Mutex::Lock sync(*pool);
+    if(cache)
+    {
+        flushStats(cache);
+    }
+    stats.allocations = pool->allocations;
+    stats.hits = pool->hits;
+    stats.cached = static_cast<Ice::Long>(pool->freeLists.size);
+    stats.threadCacheSize = static_cast<Ice::Long>(pool->threadCacheSize);
+    stats.size = static_cast<Ice::Long>(pool->maxSize);
+    return stats;
+}
+
+#if defined(_WIN32) && !defined(ICE_OS_UWP)
+void
+IceInternal::cleanupBufferPoolThread()
+{
+    if(hasKey)
+    {
+        iceBufferPoolThreadDestructor(TlsGetValue(key));
+        TlsSetValue(key, 0);
+    }
+}
+#endif
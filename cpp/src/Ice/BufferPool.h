@@ -0,0 +1,65 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_BUFFER_POOL_H
+#define ICE_BUFFER_POOL_H
+
+#include <Ice/Config.h>
+
+namespace IceInternal
+{
+
+//
+// The memory of the stream buffers is allocated from a process-wide
+// buffer pool. Buffers of up to 64KB are allocated with a power of
+// two capacity. Once released, they are kept in a cache local to the
+// releasing thread and, when this cache is full, in a pool shared by
+// all the threads. Larger buffers are allocated with malloc/realloc.
+//
+
+struct BufferPoolStats
+{
+    Ice::Long allocations; // Number of pooled buffers allocated.
+    Ice::Long hits; // Number of pooled buffers allocated from a cache.
+    Ice::Long cached; // Number of bytes held by the shared pool.
+    Ice::Long threadCacheSize; // Maximum number of bytes held by a thread cache.
+    Ice::Long size; // Maximum number of bytes held by the shared pool.
+};
+
+//
+// Returns the capacity of the buffer to allocate to hold the given
+// number of bytes.
+//
+size_t getBufferCapacity(size_t);
+
+//
+// Allocate, reallocate or deallocate a buffer. The capacity must be
+// a value returned by getBufferCapacity.
+//
+void* allocateBuffer(size_t);
+void* reallocateBuffer(void*, size_t, size_t, size_t);
+void deallocateBuffer(void*, size_t);
+
+//
+// Add or remove the maximum number of bytes held by the cache of each
+// thread and by the shared pool configured by a communicator. The pool
+// uses the largest limits configured by the communicators or the
+// default limits if none are configured.
+//
+void addBufferPoolLimits(size_t, size_t);
+void removeBufferPoolLimits(size_t, size_t);
+BufferPoolStats getBufferPoolStats();
+
+#if defined(_WIN32) && !defined(ICE_OS_UWP)
+void cleanupBufferPoolThread();
+#endif
+
+}
+
+#endif
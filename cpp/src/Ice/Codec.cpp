@@ -0,0 +1,296 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Codec.h>
+#include <Ice/LocalException.h>
+
+#ifdef ICE_HAS_BZIP2
+#  include <bzlib.h>
+#endif
+
+#ifdef ICE_HAS_ZSTD
+#  include <zstd.h>
+#endif
+
+#ifdef ICE_HAS_LZ4
+#  include <lz4.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceInternal::Codec::~Codec()
+{
+    // Out of line to avoid weak vtable
+}
+
+namespace
+{
+
+#ifdef ICE_HAS_BZIP2
+string
+getBZ2Error(int bzError)
+{
+    if(bzError == BZ_RUN_OK)
+    {
+        return ": BZ_RUN_OK";
+    }
+    else if(bzError == BZ_FLUSH_OK)
+    {
+        return ": BZ_FLUSH_OK";
+    }
+    else if(bzError == BZ_FINISH_OK)
+    {
+        return ": BZ_FINISH_OK";
+    }
+    else if(bzError == BZ_STREAM_END)
+    {
+        return ": BZ_STREAM_END";
+    }
+    else if(bzError == BZ_CONFIG_ERROR)
+    {
+        return ": BZ_CONFIG_ERROR";
+    }
+    else if(bzError == BZ_SEQUENCE_ERROR)
+    {
+        return ": BZ_SEQUENCE_ERROR";
+    }
+    else if(bzError == BZ_PARAM_ERROR)
+    {
+        return ": BZ_PARAM_ERROR";
+    }
+    else if(bzError == BZ_MEM_ERROR)
+    {
+        return ": BZ_MEM_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR)
+    {
+        return ": BZ_DATA_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR_MAGIC)
+    {
+        return ": BZ_DATA_ERROR_MAGIC";
+    }
+    else if(bzError == BZ_IO_ERROR)
+    {
+        return ": BZ_IO_ERROR";
+    }
+    else if(bzError == BZ_UNEXPECTED_EOF)
+    {
+        return ": BZ_UNEXPECTED_EOF";
+    }
+    else if(bzError == BZ_OUTBUFF_FULL)
+    {
+        return ": BZ_OUTBUFF_FULL";
+    }
+    else
+    {
+        return "";
+    }
+}
+
+class BZip2Codec : public Codec
+{
+public:
+
+    virtual Byte
+    id() const
+    {
+        return bzip2CodecId;
+    }
+
+    virtual string
+    name() const
+    {
+        return "bzip2";
+    }
+
+    virtual size_t
+    compressBound(size_t sz) const
+    {
+        return static_cast<size_t>(static_cast<double>(sz) * 1.01 + 600);
+    }
+
+    virtual size_t
+    compress(const Byte* src, size_t srcLen, Byte* dest, size_t destLen, int level) const
+    {
+        unsigned int compressedLen = static_cast<unsigned int>(destLen);
+        int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(dest), &compressedLen,
+                                               reinterpret_cast<char*>(const_cast<Byte*>(src)),
+                                               static_cast<unsigned int>(srcLen), level, 0, 0);
+        if(bzError != BZ_OK)
+        {
+            throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
+        }
+        return compressedLen;
+    }
+
+    virtual void
+    uncompress(const Byte* src, size_t srcLen, Byte* dest, size_t destLen) const
+    {
+        unsigned int uncompressedLen = static_cast<unsigned int>(destLen);
+        int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(dest), &uncompressedLen,
+                                                 reinterpret_cast<char*>(const_cast<Byte*>(src)),
+                                                 static_cast<unsigned int>(srcLen), 0, 0);
+        if(bzError != BZ_OK)
+        {
+            throw CompressionException(__FILE__, __LINE__,
+                                       "BZ2_bzBuffToBuffDecompress failed" + getBZ2Error(bzError));
+        }
+    }
+};
+BZip2Codec bzip2Codec;
+#endif
+
+#ifdef ICE_HAS_ZSTD
+class ZstdCodec : public Codec
+{
+public:
+
+    virtual Byte
+    id() const
+    {
+        return zstdCodecId;
+    }
+
+    virtual string
+    name() const
+    {
+        return "zstd";
+    }
+
+    virtual size_t
+    compressBound(size_t sz) const
+    {
+        return ZSTD_compressBound(sz);
+    }
+
+    virtual size_t
+    compress(const Byte* src, size_t srcLen, Byte* dest, size_t destLen, int level) const
+    {
+        size_t sz = ZSTD_compress(dest, destLen, src, srcLen, level);
+        if(ZSTD_isError(sz))
+        {
+            throw CompressionException(__FILE__, __LINE__, string("ZSTD_compress failed: ") + ZSTD_getErrorName(sz));
+        }
+        return sz;
+    }
+
+    virtual void
+    uncompress(const Byte* src, size_t srcLen, Byte* dest, size_t destLen) const
+    {
+        size_t sz = ZSTD_decompress(dest, destLen, src, srcLen);
+        if(ZSTD_isError(sz))
+        {
+            throw CompressionException(__FILE__, __LINE__, string("ZSTD_decompress failed: ") + ZSTD_getErrorName(sz));
+        }
+        if(sz != destLen)
+        {
+            throw CompressionException(__FILE__, __LINE__, "ZSTD_decompress failed: unexpected uncompressed size");
+        }
+    }
+};
+ZstdCodec zstdCodec;
+#endif
+
+#ifdef ICE_HAS_LZ4
+class LZ4Codec : public Codec
+{
+public:
+
+    virtual Byte
+    id() const
+    {
+        return lz4CodecId;
+    }
+
+    virtual string
+    name() const
+    {
+        return "lz4";
+    }
+
+    virtual size_t
+    compressBound(size_t sz) const
+    {
+        return static_cast<size_t>(LZ4_compressBound(static_cast<int>(sz)));
+    }
+
+    virtual size_t
+    compress(const Byte* src, size_t srcLen, Byte* dest, size_t destLen, int) const
+    {
+        //
+        // The compression level is ignored, LZ4 is always used with
+        // its default speed.
+        //
+        int sz = LZ4_compress_default(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dest),
+                                      static_cast<int>(srcLen), static_cast<int>(destLen));
+        if(sz <= 0)
+        {
+            throw CompressionException(__FILE__, __LINE__, "LZ4_compress_default failed");
+        }
+        return static_cast<size_t>(sz);
+    }
+
+    virtual void
+    uncompress(const Byte* src, size_t srcLen, Byte* dest, size_t destLen) const
+    {
+        int sz = LZ4_decompress_safe(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dest),
+                                     static_cast<int>(srcLen), static_cast<int>(destLen));
+        if(sz < 0 || static_cast<size_t>(sz) != destLen)
+        {
+            throw CompressionException(__FILE__, __LINE__, "LZ4_decompress_safe failed");
+        }
+    }
+};
+LZ4Codec lz4Codec;
+#endif
+
+const Codec* codecs[] =
+{
+#ifdef ICE_HAS_BZIP2
+    &bzip2Codec,
+#endif
+#ifdef ICE_HAS_ZSTD
+    &zstdCodec,
+#endif
+#ifdef ICE_HAS_LZ4
+    &lz4Codec,
+#endif
+    0
+};
+
+}
+
+const Codec*
+IceInternal::getCodec(Byte id)
+{
+    for(const Codec** p = codecs; *p; ++p)
+    {
+        if((*p)->id() == id)
+        {
+            return *p;
+        }
+    }
+    return 0;
+}
+
+const Codec*
+IceInternal::getCodec(const string& name)
+{
+    for(const Codec** p = codecs; *p; ++p)
+    {
+        if((*p)->name() == name)
+        {
+            return *p;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_CODEC_H
+#define ICE_CODEC_H
+
+#include <Ice/Config.h>
+#include <string>
+
+#if !defined(ICE_OS_UWP)
+#    ifndef ICE_HAS_BZIP2
+#        define ICE_HAS_BZIP2
+#    endif
+#endif
+
+namespace IceInternal
+{
+
+//
+// The compression status of a message compressed with a codec is the
+// identifier of the codec. Status 2 denotes bzip2, the codec supported
+// by all the Ice versions.
+//
+const Ice::Byte bzip2CodecId = 2;
+const Ice::Byte zstdCodecId = 3;
+const Ice::Byte lz4CodecId = 4;
+
+//
+// The compression status of an uncompressed message is 1 if the sender
+// supports compression. If the sender uses another codec than bzip2,
+// the status is instead the identifier of this codec or-ed with this
+// flag, the peer can then compress its messages with this codec if it
+// uses the same. Older Ice versions handle any status other than 0 and
+// 2 like status 1.
+//
+const Ice::Byte codecStatusFlag = 0x80;
+
+//
+// A codec compresses and uncompresses the body of protocol messages.
+// Codecs are stateless and shared by all the connections.
+//
+class Codec
+{
+public:
+
+    virtual ~Codec();
+
+    virtual Ice::Byte id() const = 0;
+    virtual std::string name() const = 0;
+
+    //
+    // Returns the maximum size of the compressed data for the given
+    // size of uncompressed data.
+    //
+    virtual size_t compressBound(size_t) const = 0;
+
+    //
+    // Compress the source data into the destination buffer and return
+    // the size of the compressed data. The compression level ranges
+    // from 1 (fastest) to 9 (best compression).
+    //
+    virtual size_t compress(const Ice::Byte*, size_t, Ice::Byte*, size_t, int) const = 0;
+
+    //
+    // Uncompress the source data into the destination buffer, the size
+    // of the destination buffer must match the size of the uncompressed
+    // data.
+    //
+    virtual void uncompress(const Ice::Byte*, size_t, Ice::Byte*, size_t) const = 0;
+};
+
+//
+// Returns the codec with the given identifier or name, or 0 if the
+// codec isn't supported by this build.
+//
+const Codec* getCodec(Ice::Byte);
+const Codec* getCodec(const std::string&);
+
+}
+
+#endif
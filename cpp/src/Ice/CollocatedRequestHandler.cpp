@@ -17,6 +17,7 @@
 #include <Ice/OutgoingAsync.h>
 
 #include <Ice/TraceUtil.h>
+#include <Ice/Segments.h>
 
 using namespace std;
 using namespace Ice;
@@ -119,7 +120,7 @@ CollocatedRequestHandler::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAs
     OutgoingAsyncPtr o = ICE_DYNAMIC_CAST(OutgoingAsync, outAsync);
     if(o)
     {
-        for(map<Int, OutgoingAsyncBasePtr>::iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
+        for(RequestTable<OutgoingAsyncBasePtr>::iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
         {
             if(q->second.get() == o.get())
             {
@@ -135,8 +136,15 @@ CollocatedRequestHandler::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAs
 }
 
 AsyncStatus
-CollocatedRequestHandler::invokeAsyncRequest(OutgoingAsyncBase* outAsync, int batchRequestNum, bool synchronous)
+CollocatedRequestHandler::invokeAsyncRequest(OutgoingAsyncBase* outAsync, int batchRequestNum, bool synchronous,
+                                             DirectInvocationState* direct)
 {
+    //
+    // The request is unmarshaled from the stream buffer, copy the byte
+    // sequences referenced by the stream.
+    //
+    flattenSegments(outAsync->getOs());
+
     //
     // Increase the direct count to prevent the thread pool from being destroyed before
     // invokeAll is called. This will also throw if the object adapter has been deactivated.
@@ -149,14 +157,23 @@ CollocatedRequestHandler::invokeAsyncRequest(OutgoingAsyncBase* outAsync, int ba
         Lock sync(*this);
 
         //
-        // This will throw if the request is canceled
+        // This will throw if the request is canceled. Direct invocations are
+        // synchronous invocations without invocation timeout, they can't be
+        // canceled.
         //
-        outAsync->cancelable(ICE_SHARED_FROM_THIS);
+        if(!direct)
+        {
+            outAsync->cancelable(ICE_SHARED_FROM_THIS);
+        }
 
         if(_response)
         {
-            requestId = ++_requestId;
-            _asyncRequests.insert(make_pair(requestId, ICE_GET_SHARED_FROM_THIS(outAsync)));
+            if(++_requestId <= 0)
+            {
+                _requestId = 1;
+            }
+            requestId = _requestId;
+            _asyncRequests.insert(requestId, ICE_GET_SHARED_FROM_THIS(outAsync));
         }
 
         _sendAsyncRequests.insert(make_pair(ICE_GET_SHARED_FROM_THIS(outAsync), requestId));
@@ -169,6 +186,7 @@ CollocatedRequestHandler::invokeAsyncRequest(OutgoingAsyncBase* outAsync, int ba
 
     outAsync->attachCollocatedObserver(_adapter, requestId);
 
+    assert(!direct || (synchronous && _response && _reference->getInvocationTimeout() <= 0 && !_dispatcher));
     if(!synchronous || !_response || _reference->getInvocationTimeout() > 0)
     {
         // Don't invoke from the user thread if async or invocation timeout is set
@@ -197,7 +215,7 @@ CollocatedRequestHandler::invokeAsyncRequest(OutgoingAsyncBase* outAsync, int ba
         CollocatedRequestHandlerPtr self(ICE_SHARED_FROM_THIS);
         if(sentAsync(outAsync))
         {
-            invokeAll(outAsync->getOs(), requestId, batchRequestNum);
+            invokeAll(outAsync->getOs(), requestId, batchRequestNum, direct);
         }
     }
     return AsyncStatusQueued;
@@ -224,7 +242,7 @@ CollocatedRequestHandler::sendResponse(Int requestId, OutputStream* os, Byte, bo
             traceRecv(is, _logger, _traceLevels);
         }
 
-        map<int, OutgoingAsyncBasePtr>::iterator q = _asyncRequests.find(requestId);
+        RequestTable<OutgoingAsyncBasePtr>::iterator q = _asyncRequests.find(requestId);
         if(q != _asyncRequests.end())
         {
             is.swap(*q->second->getIs());
@@ -309,10 +327,11 @@ CollocatedRequestHandler::sentAsync(OutgoingAsyncBase* outAsync)
 }
 
 void
-CollocatedRequestHandler::invokeAll(OutputStream* os, Int requestId, Int batchRequestNum)
+CollocatedRequestHandler::invokeAll(OutputStream* os, Int requestId, Int batchRequestNum, DirectInvocationState* direct)
 {
     if(_traceLevels->protocol >= 1)
     {
+        assert(!direct);
         fillInValue(os, 10, static_cast<Int>(os->b.size()));
         if(requestId > 0)
         {
@@ -359,6 +378,9 @@ CollocatedRequestHandler::invokeAll(OutputStream* os, Int requestId, Int batchRe
             }
 
             Incoming in(_reference->getInstance().get(), this, 0, _adapter, _response, 0, requestId);
+#ifdef ICE_CPP11_MAPPING
+            in.setDirectInvocation(direct);
+#endif
             in.invoke(servantManager, &is);
             --invokeNum;
         }
@@ -383,7 +405,7 @@ CollocatedRequestHandler::handleException(int requestId, const Exception& ex, bo
     {
         Lock sync(*this);
 
-        map<int, OutgoingAsyncBasePtr>::iterator q = _asyncRequests.find(requestId);
+        RequestTable<OutgoingAsyncBasePtr>::iterator q = _asyncRequests.find(requestId);
         if(q != _asyncRequests.end())
         {
             if(q->second->exception(ex))
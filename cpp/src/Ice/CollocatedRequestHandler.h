@@ -19,6 +19,7 @@
 #include <Ice/ObjectAdapterF.h>
 #include <Ice/LoggerF.h>
 #include <Ice/TraceLevelsF.h>
+#include <Ice/RequestTable.h>
 
 namespace Ice
 {
@@ -33,6 +34,7 @@ namespace IceInternal
 
 class OutgoingAsyncBase;
 class OutgoingAsync;
+class DirectInvocationState;
 
 class CollocatedRequestHandler : public RequestHandler,
                                  public ResponseHandler,
@@ -59,11 +61,11 @@ public:
     virtual Ice::ConnectionIPtr getConnection();
     virtual Ice::ConnectionIPtr waitForConnection();
 
-    AsyncStatus invokeAsyncRequest(OutgoingAsyncBase*, int, bool);
+    AsyncStatus invokeAsyncRequest(OutgoingAsyncBase*, int, bool, DirectInvocationState* = 0);
 
     bool sentAsync(OutgoingAsyncBase*);
 
-    void invokeAll(Ice::OutputStream*, Ice::Int, Ice::Int);
+    void invokeAll(Ice::OutputStream*, Ice::Int, Ice::Int, DirectInvocationState* = 0);
 
 #ifdef ICE_CPP11_MAPPING
     std::shared_ptr<CollocatedRequestHandler> shared_from_this()
@@ -83,7 +85,7 @@ private:
 
     int _requestId;
     std::map<OutgoingAsyncBasePtr, Ice::Int> _sendAsyncRequests;
-    std::map<Ice::Int, OutgoingAsyncBasePtr> _asyncRequests;
+    RequestTable<OutgoingAsyncBasePtr> _asyncRequests;
 };
 ICE_DEFINE_PTR(CollocatedRequestHandlerPtr, CollocatedRequestHandler);
 
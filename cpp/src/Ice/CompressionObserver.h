@@ -0,0 +1,45 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_COMPRESSION_OBSERVER_H
+#define ICE_COMPRESSION_OBSERVER_H
+
+#include <Ice/Config.h>
+
+namespace IceInternal
+{
+
+//
+// Optional interface of the connection observers notified of the
+// compression of the messages sent by the connection. It isn't part of
+// the Ice::Instrumentation::ConnectionObserver interface, the connection
+// looks it up with a cast when its observer is attached.
+//
+class CompressionObserver
+{
+public:
+
+    virtual ~CompressionObserver();
+
+    //
+    // A message of the given size was compressed to the given size in
+    // the given number of microseconds.
+    //
+    virtual void compressed(Ice::Int, Ice::Int, Ice::Long) = 0;
+
+    //
+    // A message of the given size was sent uncompressed because its
+    // compression isn't worth its cost.
+    //
+    virtual void compressionSkipped(Ice::Int) = 0;
+};
+
+}
+
+#endif
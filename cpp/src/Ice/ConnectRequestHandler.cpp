@@ -18,6 +18,8 @@
 #include <Ice/Protocol.h>
 #include <Ice/Properties.h>
 #include <Ice/ThreadPool.h>
+#include <Ice/DirectInvocationState.h>
+#include <Ice/Segments.h>
 
 using namespace std;
 using namespace IceInternal;
@@ -63,6 +65,10 @@ ConnectRequestHandler::sendAsyncRequest(const ProxyOutgoingAsyncBasePtr& out)
 
         if(!initialized())
         {
+#ifdef ICE_CPP11_MAPPING
+            DirectInvocationState::marshal(out.get()); // The request is sent once the invocation returned.
+#endif
+            flattenSegments(out->getOs()); // The request is sent from another thread.
             _requests.push_back(out);
             return AsyncStatusQueued;
         }
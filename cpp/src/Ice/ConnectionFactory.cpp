@@ -247,10 +247,15 @@ IceInternal::OutgoingConnectionFactory::create(const vector<EndpointIPtr>& endpt
     try
     {
         bool compress;
-        Ice::ConnectionIPtr connection = findConnection(endpoints, compress);
+        EndpointIPtr stripe;
+        Ice::ConnectionIPtr connection = findConnection(endpoints, compress, stripe);
         if(connection)
         {
             callback->setConnection(connection, compress);
+            if(stripe)
+            {
+                createStripe(stripe, selType);
+            }
             return;
         }
     }
@@ -377,7 +382,12 @@ IceInternal::OutgoingConnectionFactory::OutgoingConnectionFactory(const Communic
     _communicator(communicator),
     _instance(instance),
     _monitor(new FactoryACMMonitor(instance, instance->clientACM())),
+    _connectionPoolSize(static_cast<size_t>(
+        max(instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.ConnectionPool.Size", 1), 1))),
+    _leastOutstanding(instance->initializationData().properties->getProperty("Ice.ConnectionPool.Selection") ==
+                      "LeastOutstanding"),
     _destroyed(false),
+    _nextConnection(0),
     _pendingConnectCount(0)
 {
 }
@@ -409,8 +419,60 @@ IceInternal::OutgoingConnectionFactory::applyOverrides(const vector<EndpointIPtr
     return endpoints;
 }
 
+template<typename Map> ConnectionIPtr
+IceInternal::OutgoingConnectionFactory::selectConnection(const Map& m, const typename Map::key_type& k, size_t& count)
+{
+    // This must be called with the mutex locked.
+
+    vector<ConnectionIPtr> connections;
+    pair<typename Map::const_iterator, typename Map::const_iterator> pr = m.equal_range(k);
+    for(typename Map::const_iterator p = pr.first; p != pr.second; ++p)
+    {
+        if(p->second->isActiveOrHolding())
+        {
+            connections.push_back(p->second);
+        }
+    }
+
+    count = connections.size();
+    if(connections.empty())
+    {
+        return ICE_NULLPTR;
+    }
+
+    size_t start = _nextConnection++ % connections.size();
+    if(!_leastOutstanding)
+    {
+        return connections[start];
+    }
+
+    //
+    // Select the connection with the fewest outstanding requests. The
+    // connections are checked in round-robin order to spread requests
+    // over connections with the same number of outstanding requests.
+    //
+    ConnectionIPtr connection;
+    size_t outstanding = 0;
+    for(size_t i = 0; i < connections.size(); ++i)
+    {
+        const ConnectionIPtr& c = connections[(start + i) % connections.size()];
+        size_t n = c->getOutstandingRequests();
+        if(!connection || n < outstanding)
+        {
+            connection = c;
+            outstanding = n;
+            if(outstanding == 0)
+            {
+                break;
+            }
+        }
+    }
+    return connection;
+}
+
 ConnectionIPtr
-IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr>& endpoints, bool& compress)
+IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr>& endpoints, bool& compress,
+                                                       EndpointIPtr& stripe)
 {
     IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
     if(_destroyed)
@@ -422,7 +484,31 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr
     assert(!endpoints.empty());
     for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
     {
-        ConnectionIPtr connection = find(_connectionsByEndpoint, *p, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
+        ConnectionIPtr connection;
+        if(_connectionPoolSize > 1 && !(*p)->datagram())
+        {
+            //
+            // If the pool of connections of the endpoint isn't full, a
+            // new connection is established in the background. The
+            // request is sent over an existing connection meanwhile.
+            // Datagram endpoints only use a single connection.
+            //
+            size_t count;
+            connection = selectConnection(_connectionsByEndpoint, *p, count);
+            if(connection && count < _connectionPoolSize)
+            {
+                EndpointIPtr endpoint = (*p)->compress(false);
+                if(_stripes.find(endpoint) == _stripes.end())
+                {
+                    _stripes.insert(endpoint);
+                    stripe = *p;
+                }
+            }
+        }
+        else
+        {
+            connection = find(_connectionsByEndpoint, *p, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
+        }
         if(connection)
         {
             if(defaultsAndOverrides->overrideCompress)
@@ -440,7 +526,8 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr
 }
 
 ConnectionIPtr
-IceInternal::OutgoingConnectionFactory::findConnection(const vector<ConnectorInfo>& connectors, bool& compress)
+IceInternal::OutgoingConnectionFactory::findConnection(const vector<ConnectorInfo>& connectors, bool stripe,
+                                                       bool& compress)
 {
     // This must be called with the mutex locked.
 
@@ -452,7 +539,24 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<ConnectorInf
             continue;
         }
 
-        ConnectionIPtr connection = find(_connections, p->connector, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
+        ConnectionIPtr connection;
+        if(_connectionPoolSize > 1)
+        {
+            //
+            // A connection established to add a connection to the pool
+            // only returns an existing connection if the pool is full.
+            //
+            size_t count;
+            connection = selectConnection(_connections, p->connector, count);
+            if(stripe && count < _connectionPoolSize)
+            {
+                connection = ICE_NULLPTR;
+            }
+        }
+        else
+        {
+            connection = find(_connections, p->connector, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
+        }
         if(connection)
         {
             if(defaultsAndOverrides->overrideCompress)
@@ -504,6 +608,7 @@ IceInternal::OutgoingConnectionFactory::decPendingConnectCount()
 ConnectionIPtr
 IceInternal::OutgoingConnectionFactory::getConnection(const vector<ConnectorInfo>& connectors,
                                                       const ConnectCallbackPtr& cb,
+                                                      bool stripe,
                                                       bool& compress)
 {
     {
@@ -523,6 +628,11 @@ IceInternal::OutgoingConnectionFactory::getConnection(const vector<ConnectorInfo
             remove(_connections, (*p)->connector(), *p);
             remove(_connectionsByEndpoint, (*p)->endpoint(), *p);
             remove(_connectionsByEndpoint, (*p)->endpoint()->compress(true), *p);
+            EndpointIPtr endpoint = (*p)->endpoint()->compress(false);
+            if(_connectionsByEndpoint.find(endpoint->compress(true)) == _connectionsByEndpoint.end())
+            {
+                _stripes.erase(endpoint);
+            }
         }
 
         //
@@ -540,7 +650,7 @@ IceInternal::OutgoingConnectionFactory::getConnection(const vector<ConnectorInfo
             //
             // Search for a matching connection. If we find one, we're done.
             //
-            Ice::ConnectionIPtr connection = findConnection(connectors, compress);
+            Ice::ConnectionIPtr connection = findConnection(connectors, stripe, compress);
             if(connection)
             {
                 return connection;
@@ -810,6 +920,36 @@ IceInternal::OutgoingConnectionFactory::removeFromPending(const ConnectCallbackP
     }
 }
 
+void
+IceInternal::OutgoingConnectionFactory::createStripe(const EndpointIPtr& endpoint, Ice::EndpointSelectionType selType)
+{
+    vector<EndpointIPtr> endpoints;
+    endpoints.push_back(endpoint);
+#ifdef ICE_CPP11_MAPPING
+    auto cb = make_shared<ConnectCallback>(_instance, this, endpoints, false, new StripeCallback(this, endpoint),
+                                           selType, true);
+#else
+    ConnectCallbackPtr cb = new ConnectCallback(_instance, this, endpoints, false, new StripeCallback(this, endpoint),
+                                                selType, true);
+#endif
+    cb->getConnectors();
+}
+
+void
+IceInternal::OutgoingConnectionFactory::finishStripe(const EndpointIPtr& endpoint, bool success)
+{
+    //
+    // If the connection establishment failed, no more connections are
+    // added to the pool of this endpoint until its connections are
+    // closed.
+    //
+    if(success)
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+        _stripes.erase(endpoint->compress(false));
+    }
+}
+
 void
 IceInternal::OutgoingConnectionFactory::handleException(const LocalException& ex, bool hasMore)
 {
@@ -871,13 +1011,15 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const I
                                                                          const vector<EndpointIPtr>& endpoints,
                                                                          bool hasMore,
                                                                          const CreateConnectionCallbackPtr& cb,
-                                                                         Ice::EndpointSelectionType selType) :
+                                                                         Ice::EndpointSelectionType selType,
+                                                                         bool stripe) :
     _instance(instance),
     _factory(factory),
     _endpoints(endpoints),
     _hasMore(hasMore),
     _callback(cb),
-    _selType(selType)
+    _selType(selType),
+    _stripe(stripe)
 {
     _endpointsIter = _endpoints.begin();
 }
@@ -1006,7 +1148,7 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::getConnection()
         // connection.
         //
         bool compress;
-        Ice::ConnectionIPtr connection = _factory->getConnection(_connectors, ICE_SHARED_FROM_THIS, compress);
+        Ice::ConnectionIPtr connection = _factory->getConnection(_connectors, ICE_SHARED_FROM_THIS, _stripe, compress);
         if(!connection)
         {
             //
@@ -1154,6 +1296,25 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedIm
     return false;
 }
 
+IceInternal::OutgoingConnectionFactory::StripeCallback::StripeCallback(const OutgoingConnectionFactoryPtr& factory,
+                                                                       const EndpointIPtr& endpoint) :
+    _factory(factory),
+    _endpoint(endpoint)
+{
+}
+
+void
+IceInternal::OutgoingConnectionFactory::StripeCallback::setConnection(const Ice::ConnectionIPtr&, bool)
+{
+    _factory->finishStripe(_endpoint, true);
+}
+
+void
+IceInternal::OutgoingConnectionFactory::StripeCallback::setException(const Ice::LocalException&)
+{
+    _factory->finishStripe(_endpoint, false);
+}
+
 void
 IceInternal::IncomingConnectionFactory::activate()
 {
@@ -96,7 +96,7 @@ private:
     public:
 
         ConnectCallback(const InstancePtr&, const OutgoingConnectionFactoryPtr&, const std::vector<EndpointIPtr>&, bool,
-                        const CreateConnectionCallbackPtr&, Ice::EndpointSelectionType);
+                        const CreateConnectionCallbackPtr&, Ice::EndpointSelectionType, bool = false);
 
         virtual void connectionStartCompleted(const Ice::ConnectionIPtr&);
         virtual void connectionStartFailed(const Ice::ConnectionIPtr&, const Ice::LocalException&);
@@ -129,6 +129,7 @@ private:
         const bool _hasMore;
         const CreateConnectionCallbackPtr _callback;
         const Ice::EndpointSelectionType _selType;
+        const bool _stripe;
         Ice::Instrumentation::ObserverPtr _observer;
         std::vector<EndpointIPtr>::const_iterator _endpointsIter;
         std::vector<ConnectorInfo> _connectors;
@@ -137,11 +138,31 @@ private:
     ICE_DEFINE_PTR(ConnectCallbackPtr, ConnectCallback);
     friend class ConnectCallback;
 
+    //
+    // The callback of the connections established in the background to
+    // add a connection to the pool of connections of an endpoint.
+    //
+    class StripeCallback : public CreateConnectionCallback
+    {
+    public:
+
+        StripeCallback(const OutgoingConnectionFactoryPtr&, const EndpointIPtr&);
+
+        virtual void setConnection(const Ice::ConnectionIPtr&, bool);
+        virtual void setException(const Ice::LocalException&);
+
+    private:
+
+        const OutgoingConnectionFactoryPtr _factory;
+        const EndpointIPtr _endpoint;
+    };
+    friend class StripeCallback;
+
     std::vector<EndpointIPtr> applyOverrides(const std::vector<EndpointIPtr>&);
-    Ice::ConnectionIPtr findConnection(const std::vector<EndpointIPtr>&, bool&);
+    Ice::ConnectionIPtr findConnection(const std::vector<EndpointIPtr>&, bool&, EndpointIPtr&);
     void incPendingConnectCount();
     void decPendingConnectCount();
-    Ice::ConnectionIPtr getConnection(const std::vector<ConnectorInfo>&, const ConnectCallbackPtr&, bool&);
+    Ice::ConnectionIPtr getConnection(const std::vector<ConnectorInfo>&, const ConnectCallbackPtr&, bool, bool&);
     void finishGetConnection(const std::vector<ConnectorInfo>&, const ConnectorInfo&, const Ice::ConnectionIPtr&,
                              const ConnectCallbackPtr&);
     void finishGetConnection(const std::vector<ConnectorInfo>&, const Ice::LocalException&, const ConnectCallbackPtr&);
@@ -149,15 +170,21 @@ private:
     bool addToPending(const ConnectCallbackPtr&, const std::vector<ConnectorInfo>&);
     void removeFromPending(const ConnectCallbackPtr&, const std::vector<ConnectorInfo>&);
 
-    Ice::ConnectionIPtr findConnection(const std::vector<ConnectorInfo>&, bool&);
+    Ice::ConnectionIPtr findConnection(const std::vector<ConnectorInfo>&, bool, bool&);
     Ice::ConnectionIPtr createConnection(const TransceiverPtr&, const ConnectorInfo&);
 
+    template<typename Map> Ice::ConnectionIPtr selectConnection(const Map&, const typename Map::key_type&, size_t&);
+    void createStripe(const EndpointIPtr&, Ice::EndpointSelectionType);
+    void finishStripe(const EndpointIPtr&, bool);
+
     void handleException(const Ice::LocalException&, bool);
     void handleConnectionException(const Ice::LocalException&, bool);
 
     Ice::CommunicatorPtr _communicator;
     const InstancePtr _instance;
     const FactoryACMMonitorPtr _monitor;
+    const size_t _connectionPoolSize;
+    const bool _leastOutstanding;
     bool _destroyed;
 
     std::multimap<ConnectorPtr, Ice::ConnectionIPtr> _connections;
@@ -165,9 +192,12 @@ private:
 
 #ifdef ICE_CPP11_MAPPING
     std::multimap<EndpointIPtr, Ice::ConnectionIPtr, Ice::TargetCompare<EndpointIPtr, std::less>> _connectionsByEndpoint;
+    std::set<EndpointIPtr, Ice::TargetCompare<EndpointIPtr, std::less>> _stripes;
 #else
     std::multimap<EndpointIPtr, Ice::ConnectionIPtr> _connectionsByEndpoint;
+    std::set<EndpointIPtr> _stripes;
 #endif
+    size_t _nextConnection;
     int _pendingConnectCount;
 };
 
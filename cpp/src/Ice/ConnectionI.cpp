@@ -27,10 +27,9 @@
 #include <Ice/ReferenceFactory.h> // For createProxy().
 #include <Ice/ProxyFactory.h> // For createProxy().
 #include <Ice/BatchRequestQueue.h>
-
-#ifdef ICE_HAS_BZIP2
-#  include <bzlib.h>
-#endif
+#include <Ice/ServantManager.h>
+#include <Ice/ReplyStatus.h>
+#include <IceUtil/InputUtil.h>
 
 using namespace std;
 using namespace Ice;
@@ -46,6 +45,20 @@ namespace
 
 const ::std::string flushBatchRequests_name = "flushBatchRequests";
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+//
+// The maximum number of queued messages and bytes gathered in a
+// single write.
+//
+const size_t maxGatherMessages = 64;
+const size_t maxGatherSize = 256 * 1024;
+#endif
+
+//
+// The maximum dispatch budget of a request, in milliseconds.
+//
+const IceUtil::Int64 maxDispatchBudget = 0x7fffffff;
+
 class TimeoutCallback : public IceUtil::TimerTask
 {
 public:
@@ -231,7 +244,7 @@ ConnectionFlushBatchAsync::invoke(const string& operation, Ice::CompressBatch co
     }
 }
 
-Ice::ConnectionI::Observer::Observer() : _readStreamPos(0), _writeStreamPos(0)
+Ice::ConnectionI::Observer::Observer() : _readStreamPos(0), _writeStreamPos(0), _compression(0)
 {
 }
 
@@ -287,6 +300,7 @@ void
 Ice::ConnectionI::Observer::attach(const Ice::Instrumentation::ConnectionObserverPtr& observer)
 {
     ObserverHelperT<Ice::Instrumentation::ConnectionObserver>::attach(observer);
+    _compression = dynamic_cast<CompressionObserver*>(observer.get());
     if(!observer)
     {
         _writeStreamPos = 0;
@@ -294,6 +308,13 @@ Ice::ConnectionI::Observer::attach(const Ice::Instrumentation::ConnectionObserve
     }
 }
 
+void
+Ice::ConnectionI::Observer::detach()
+{
+    ObserverHelperT<Ice::Instrumentation::ConnectionObserver>::detach();
+    _compression = 0;
+}
+
 void
 Ice::ConnectionI::OutgoingMessage::adopt(OutputStream* str)
 {
@@ -534,6 +555,13 @@ Ice::ConnectionI::isActiveOrHolding() const
     return _state > StateNotValidated && _state < StateClosing;
 }
 
+size_t
+Ice::ConnectionI::getOutstandingRequests() const
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    return _asyncRequests.size() + _sendStreams.size();
+}
+
 bool
 Ice::ConnectionI::isFinished() const
 {
@@ -623,13 +651,13 @@ Ice::ConnectionI::updateObserver()
     _observer.attach(o);
 }
 
-void
+IceUtil::Time
 Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
 {
     IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
     if(_state != StateActive)
     {
-        return;
+        return IceUtil::Time();
     }
     assert(acm.timeout != IceUtil::Time());
 
@@ -637,13 +665,7 @@ Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
     // We send a heartbeat if there was no activity in the last
     // (timeout / 4) period. Sending a heartbeat sooner than really
     // needed is safer to ensure that the receiver will receive the
-    // heartbeat in time. Sending the heartbeat if there was no
-    // activity in the last (timeout / 2) period isn't enough since
-    // monitor() is called only every (timeout / 2) period.
-    //
-    // Note that this doesn't imply that we are sending 4 heartbeats
-    // per timeout period because the monitor() method is still only
-    // called every (timeout / 2) period.
+    // heartbeat in time.
     //
     if(acm.heartbeat == ICE_ENUM(ACMHeartbeat, HeartbeatAlways) ||
        (acm.heartbeat != ICE_ENUM(ACMHeartbeat, HeartbeatOff) &&
@@ -655,6 +677,29 @@ Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
         }
     }
 
+    //
+    // Compute when the connection needs to be monitored again. If the
+    // deadline of a check already passed without the check being
+    // acted upon, the connection is monitored again after the (timeout
+    // / 2) period. The deadlines are computed from the last activity,
+    // later activity only delays the next action.
+    //
+    const IceUtil::Time period = acm.timeout / 2;
+    IceUtil::Time next;
+    if(acm.heartbeat == ICE_ENUM(ACMHeartbeat, HeartbeatAlways))
+    {
+        next = now + period;
+    }
+    else if(acm.heartbeat == ICE_ENUM(ACMHeartbeat, HeartbeatOnIdle) ||
+            (acm.heartbeat == ICE_ENUM(ACMHeartbeat, HeartbeatOnDispatch) && _dispatchCount > 0))
+    {
+        next = _acmLastActivity + acm.timeout / 4;
+        if(next <= now)
+        {
+            next = now + period;
+        }
+    }
+
     if(static_cast<Int>(_readStream.b.size()) > headerSize || !_writeStream.b.empty())
     {
         //
@@ -663,7 +708,7 @@ Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
         // This check is necessary because the actitivy timer is
         // only set when a message is fully read/written.
         //
-        return;
+        return next == IceUtil::Time() || next > now + period ? now + period : next;
     }
 
     if(acm.close != ICE_ENUM(ACMClose, CloseOff) && now >= (_acmLastActivity + acm.timeout))
@@ -676,6 +721,7 @@ Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
             // the last period.
             //
             setState(StateClosed, ConnectionTimeoutException(__FILE__, __LINE__));
+            return IceUtil::Time();
         }
         else if(acm.close != ICE_ENUM(ACMClose, CloseOnInvocation) &&
                 _dispatchCount == 0 && _batchRequestQueue->isEmpty() && _asyncRequests.empty())
@@ -684,8 +730,30 @@ Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
             // The connection is idle, close it.
             //
             setState(StateClosing, ConnectionTimeoutException(__FILE__, __LINE__));
+            return IceUtil::Time();
+        }
+    }
+
+    if(acm.close != ICE_ENUM(ACMClose, CloseOff) &&
+       (acm.close != ICE_ENUM(ACMClose, CloseOnInvocation) || !_asyncRequests.empty()))
+    {
+        IceUtil::Time close = _acmLastActivity + acm.timeout;
+        if(close <= now)
+        {
+            close = now + period;
+        }
+        if(next == IceUtil::Time() || close < next)
+        {
+            next = close;
         }
     }
+
+    //
+    // If there's nothing to monitor until the next dispatch or
+    // invocation, the monitor is notified when it occurs.
+    //
+    _acmUnscheduled = next == IceUtil::Time();
+    return next;
 }
 
 AsyncStatus
@@ -720,6 +788,16 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
     Int requestId = 0;
     if(response)
     {
+        //
+        // Notify the ACM monitor if it waits for an invocation to
+        // monitor the connection again.
+        //
+        if(_acmUnscheduled)
+        {
+            _acmUnscheduled = false;
+            _monitor->check(ICE_SHARED_FROM_THIS);
+        }
+
         //
         // Create a new unique request ID.
         //
@@ -760,6 +838,9 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
     }
     catch(const LocalException& ex)
     {
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+        flattenSegments(os); // The request might be retried right away.
+#endif
         setState(StateClosed, ex);
         assert(_exception);
         _exception->ice_throw();
@@ -768,10 +849,9 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
     if(response)
     {
         //
-        // Add to the async requests map.
+        // Add to the async requests table.
         //
-        _asyncRequestsHint = _asyncRequests.insert(_asyncRequests.end(),
-                                                   pair<const Int, OutgoingAsyncBasePtr>(requestId, out));
+        _asyncRequests.insert(requestId, out);
     }
     return status;
 }
@@ -1169,6 +1249,7 @@ Ice::ConnectionI::setACM(const IceUtil::Optional<int>& timeout,
 
     if(_state == StateActive)
     {
+        _acmUnscheduled = false;
         _monitor->add(ICE_SHARED_FROM_THIS);
     }
 }
@@ -1203,16 +1284,7 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
         {
             if(o->requestId)
             {
-                if(_asyncRequestsHint != _asyncRequests.end() &&
-                   _asyncRequestsHint->second == ICE_DYNAMIC_CAST(OutgoingAsync, outAsync))
-                {
-                    _asyncRequests.erase(_asyncRequestsHint);
-                    _asyncRequestsHint = _asyncRequests.end();
-                }
-                else
-                {
-                    _asyncRequests.erase(o->requestId);
-                }
+                _asyncRequests.erase(o->requestId);
             }
 
             if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
@@ -1225,12 +1297,25 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
                 // If the request is being sent, don't remove it from the send streams,
                 // it will be removed once the sending is finished.
                 //
-                if(o == _sendStreams.begin())
+                // A queued message might also be partially sent if it was
+                // gathered with the message being sent.
+                //
+                if(o == _sendStreams.begin() || o->stream->i)
                 {
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+                    //
+                    // The caller's memory is no longer valid once the request
+                    // is canceled, copy the byte sequences of the message.
+                    //
+                    flattenSegments(o->stream);
+#endif
                     o->canceled(true); // true = adopt the stream
                 }
                 else
                 {
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+                    _requestSegments.erase(o->stream);
+#endif
                     o->canceled(false);
                     _sendStreams.erase(o);
                 }
@@ -1245,28 +1330,7 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
 
     if(ICE_DYNAMIC_CAST(OutgoingAsync, outAsync))
     {
-        if(_asyncRequestsHint != _asyncRequests.end())
-        {
-            if(_asyncRequestsHint->second == outAsync)
-            {
-                if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
-                {
-                    setState(StateClosed, ex);
-                }
-                else
-                {
-                    _asyncRequests.erase(_asyncRequestsHint);
-                    _asyncRequestsHint = _asyncRequests.end();
-                    if(outAsync->exception(ex))
-                    {
-                        outAsync->invokeExceptionAsync();
-                    }
-                }
-                return;
-            }
-        }
-
-        for(map<Int, OutgoingAsyncBasePtr>::iterator p = _asyncRequests.begin(); p != _asyncRequests.end(); ++p)
+        for(RequestTable<OutgoingAsyncBasePtr>::iterator p = _asyncRequests.begin(); p != _asyncRequests.end(); ++p)
         {
             if(p->second.get() == outAsync.get())
             {
@@ -1276,8 +1340,10 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
                 }
                 else
                 {
-                    assert(p != _asyncRequestsHint);
                     _asyncRequests.erase(p);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+                    _requestSegments.erase(outAsync->getOs());
+#endif
                     if(outAsync->exception(ex))
                     {
                         outAsync->invokeExceptionAsync();
@@ -1598,14 +1664,23 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
             SocketOperation readOp = SocketOperationNone;
             if(readyOp & SocketOperationWrite)
             {
-                if(_observer)
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+                if(_segmentCount > 0)
                 {
-                    _observer.startWrite(_writeStream);
+                    writeOp = writeSegments(_writeStream);
                 }
-                writeOp = write(_writeStream);
-                if(_observer && !(writeOp & SocketOperationWrite))
+                else
+#endif
                 {
-                    _observer.finishWrite(_writeStream);
+                    if(_observer)
+                    {
+                        _observer.startWrite(_writeStream);
+                    }
+                    writeOp = write(_writeStream);
+                    if(_observer && !(writeOp & SocketOperationWrite))
+                    {
+                        _observer.finishWrite(_writeStream);
+                    }
                 }
             }
 
@@ -1780,7 +1855,24 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 return; // Nothing to dispatch we're done!
             }
 
+            //
+            // Notify the ACM monitor if it waits for a dispatch to
+            // monitor the connection again. With heartbeats on dispatch,
+            // also notify it when the connection starts dispatching: the
+            // monitor might otherwise not check the connection before the
+            // first heartbeat is due.
+            //
+            bool check = _acmUnscheduled ||
+                (_dispatchCount == 0 && _monitor &&
+                 _monitor->getACM().heartbeat == ICE_ENUM(ACMHeartbeat, HeartbeatOnDispatch));
+
             _dispatchCount += dispatchCount;
+
+            if(check)
+            {
+                _acmUnscheduled = false;
+                _monitor->check(ICE_SHARED_FROM_THIS);
+            }
             io.completed();
         }
         catch(const DatagramLimitException&) // Expected.
@@ -1828,9 +1920,19 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
     }
     else
     {
-        _threadPool->dispatchFromThisThread(new DispatchCall(ICE_SHARED_FROM_THIS, startCB, sentCBs, compress, requestId,
-                                                             invokeNum, servantManager, adapter, outAsync,
-                                                             heartbeatCallback, current.stream));
+        //
+        // If the executor of the thread pool orders the messages, requests
+        // are queued according to their deadline. Other messages are queued
+        // with a null deadline and dispatched first.
+        //
+        IceUtil::Time deadline;
+        if(invokeNum > 0 && _threadPool->executorDeadline() > 0)
+        {
+            deadline = dispatchDeadline(current.stream, servantManager);
+        }
+        current.dispatchFromThisThread(new DispatchCall(ICE_SHARED_FROM_THIS, startCB, sentCBs, compress, requestId,
+                                                        invokeNum, servantManager, adapter, outAsync,
+                                                        heartbeatCallback, current.stream), deadline);
 
     }
 }
@@ -2047,6 +2149,17 @@ Ice::ConnectionI::finish(bool close)
         _startCallback = 0;
     }
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    //
+    // The requests might be retried, copy the byte sequences they reference
+    // while their callers still wait.
+    //
+    while(!_requestSegments.empty())
+    {
+        flattenSegments(_requestSegments.begin()->first);
+    }
+#endif
+
     if(!_sendStreams.empty())
     {
         if(!_writeStream.b.empty())
@@ -2057,6 +2170,9 @@ Ice::ConnectionI::finish(bool close)
             //
             OutgoingMessage* message = &_sendStreams.front();
             _writeStream.swap(*message->stream);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+            _segmentCount = 0;
+#endif
 
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
             //
@@ -2095,7 +2211,7 @@ Ice::ConnectionI::finish(bool close)
         _sendStreams.clear();
     }
 
-    for(map<Int, OutgoingAsyncBasePtr>::const_iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
+    for(RequestTable<OutgoingAsyncBasePtr>::iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
     {
         if(q->second->exception(*_exception))
         {
@@ -2112,6 +2228,10 @@ Ice::ConnectionI::finish(bool close)
     _writeStream.b.clear();
     _readStream.clear();
     _readStream.b.clear();
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    _readAhead.b.clear();
+    _readAhead.i = _readAheadPos = _readAhead.b.begin();
+#endif
 
     if(_closeCallback)
     {
@@ -2234,14 +2354,24 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _readTimeoutScheduled(false),
     _warn(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Connections") > 0),
     _warnUdp(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Datagrams") > 0),
+    _acmUnscheduled(false),
     _compressionLevel(1),
+    _codec(getCodec(bzip2CodecId)),
+    _sendCodec(_codec),
+    _compressionStatus(1),
+    _adaptiveCompression(_instance->initializationData().properties->getPropertyAsInt(
+                             "Ice.Compression.Adaptive") > 0),
+    _adaptiveCompressionThreshold(_instance->initializationData().properties->getPropertyAsIntWithDefault(
+                                      "Ice.Compression.AdaptiveThreshold", 1000)),
     _nextRequestId(1),
-    _asyncRequestsHint(_asyncRequests.end()),
     _messageSizeMax(adapter ? adapter->messageSizeMax() : _instance->messageSizeMax()),
     _batchRequestQueue(new BatchRequestQueue(instance, endpoint->datagram())),
     _readStream(_instance.get(), Ice::currentProtocolEncoding),
     _readHeader(false),
     _writeStream(_instance.get(), Ice::currentProtocolEncoding),
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    _segmentCount(0),
+#endif
     _dispatchCount(0),
     _state(StateNotInitialized),
     _shutdownInitiated(false),
@@ -2261,6 +2391,31 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
         compressionLevel = 9;
     }
 
+    //
+    // Messages are compressed with bzip2 until the peer advertises the
+    // codec set with Ice.Compression.Codec. The codec name is checked
+    // when the communicator is initialized.
+    //
+    const Codec* codec = getCodec(properties->getPropertyWithDefault("Ice.Compression.Codec", "bzip2"));
+    if(codec && codec->id() != bzip2CodecId)
+    {
+        _codec = codec;
+        const_cast<Byte&>(_compressionStatus) = codecStatusFlag | codec->id();
+    }
+
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    //
+    // Data is read ahead in chunks of Ice.ReadAheadSize kilobytes if
+    // set and if supported by the transceiver.
+    //
+    Int readAheadSize = properties->getPropertyAsIntWithDefault("Ice.ReadAheadSize", 0);
+    if(readAheadSize > 0 && _transceiver->supportsReadAhead())
+    {
+        _readAhead.b.resize(static_cast<size_t>(readAheadSize) * 1024);
+    }
+    _readAhead.i = _readAheadPos = _readAhead.b.begin();
+#endif
+
     if(adapter)
     {
         _servantManager = adapter->getServantManager();
@@ -2285,11 +2440,19 @@ Ice::ConnectionI::create(const CommunicatorPtr& communicator,
                                              endpoint, adapter));
     if(adapter)
     {
-        const_cast<ThreadPoolPtr&>(conn->_threadPool) = adapter->getThreadPool();
+        const_cast<ThreadPoolPtr&>(conn->_threadPool) = adapter->getThreadPool()->nextReactor();
     }
     else
     {
-        const_cast<ThreadPoolPtr&>(conn->_threadPool) = conn->_instance->clientThreadPool();
+        const_cast<ThreadPoolPtr&>(conn->_threadPool) = conn->_instance->clientThreadPool()->nextReactor();
+    }
+    if(conn->_threadPool->hasExecutor())
+    {
+        //
+        // Messages are dispatched by the executor of the thread pool, they
+        // go through dispatchFromThisThread() like with a dispatcher.
+        //
+        const_cast<bool&>(conn->_dispatcher) = true;
     }
     conn->_threadPool->initialize(conn);
     return conn;
@@ -2304,6 +2467,13 @@ Ice::ConnectionI::~ConnectionI()
     assert(_dispatchCount == 0);
     assert(_sendStreams.empty());
     assert(_asyncRequests.empty());
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    assert(_requestSegments.empty());
+    for(vector<Buffer*>::const_iterator p = _segmentBuffers.begin(); p != _segmentBuffers.end(); ++p)
+    {
+        delete *p;
+    }
+#endif
 }
 
 void
@@ -2493,6 +2663,7 @@ Ice::ConnectionI::setState(State state)
             {
                 _acmLastActivity = IceUtil::Time::now(IceUtil::Time::Monotonic);
             }
+            _acmUnscheduled = false;
             _monitor->add(ICE_SHARED_FROM_THIS);
         }
         else if(_state == StateActive)
@@ -2654,7 +2825,11 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 _writeStream.write(currentProtocol);
                 _writeStream.write(currentProtocolEncoding);
                 _writeStream.write(validateConnectionMsg);
-                _writeStream.write(static_cast<Byte>(0)); // Compression status (always zero for validate connection).
+                //
+                // The compression status is zero unless the codec of this
+                // connection needs to be advertised to the client.
+                //
+                _writeStream.write(static_cast<Byte>(_compressionStatus != 1 ? _compressionStatus : 0));
                 _writeStream.write(headerSize); // Message size.
                 _writeStream.i = _writeStream.b.begin();
                 traceSend(_writeStream, _logger, _traceLevels);
@@ -2734,7 +2909,11 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 throw ConnectionNotValidatedException(__FILE__, __LINE__);
             }
             Byte compress;
-            _readStream.read(compress); // Ignore compression status for validate connection.
+            _readStream.read(compress);
+            if(compress == _compressionStatus)
+            {
+                _sendCodec = _codec; // The server uses the same codec.
+            }
             Int size;
             _readStream.read(size);
             if(size != headerSize)
@@ -2784,6 +2963,9 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
         // Message wasn't sent, empty the _writeStream, we're not going to send more data.
         OutgoingMessage* message = &_sendStreams.front();
         _writeStream.swap(*message->stream);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+        _segmentCount = 0;
+#endif
         return SocketOperationNone;
     }
 
@@ -2799,6 +2981,12 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             if(message->stream)
             {
                 _writeStream.swap(*message->stream);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+                if(!message->requestId && !_requestSegments.empty())
+                {
+                    _requestSegments.erase(message->stream);
+                }
+#endif
                 if(message->sent())
                 {
                     callbacks.push_back(*message);
@@ -2827,61 +3015,33 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             }
 
             //
-            // Otherwise, prepare the next message stream for writing.
+            // Otherwise, prepare the next message stream for writing. The
+            // message might already be prepared and partially written if
+            // it was gathered with the previous message.
             //
             message = &_sendStreams.front();
-            assert(!message->stream->i);
-#ifdef ICE_HAS_BZIP2
-            if(message->compress && message->stream->b.size() >= 100) // Only compress messages > 100 bytes.
+            if(!message->stream->i)
             {
-                //
-                // Message compressed. Request compressed response, if any.
-                //
-                message->stream->b[9] = 2;
-
-                //
-                // Do compression.
-                //
-                OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
-                doCompress(*message->stream, stream);
-
-                traceSend(*message->stream, _logger, _traceLevels);
-
-                message->adopt(&stream); // Adopt the compressed stream.
-                message->stream->i = message->stream->b.begin();
+                prepareMessage(*message);
             }
-            else
-            {
-#endif
-                if(message->compress)
-                {
-                    //
-                    // Message not compressed. Request compressed response, if any.
-                    //
-                    message->stream->b[9] = 1;
-                }
-
-                //
-                // No compression, just fill in the message size.
-                //
-                Int sz = static_cast<Int>(message->stream->b.size());
-                const Byte* p = reinterpret_cast<const Byte*>(&sz);
-#ifdef ICE_BIG_ENDIAN
-                reverse_copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
-#else
-                copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
-#endif
-                message->stream->i = message->stream->b.begin();
-                traceSend(*message->stream, _logger, _traceLevels);
-
-#ifdef ICE_HAS_BZIP2
-            }
-#endif
             _writeStream.swap(*message->stream);
 
             //
             // Send the message.
             //
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+            const SegmentList* segments = getSegments(message->stream);
+            if(segments)
+            {
+                prepareSegments(_writeStream, *segments);
+                SocketOperation op = writeSegments(_writeStream);
+                if(op)
+                {
+                    return op;
+                }
+                continue;
+            }
+#endif
             if(_observer)
             {
                 _observer.startWrite(_writeStream);
@@ -2889,7 +3049,12 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             assert(_writeStream.i);
             if(_writeStream.i != _writeStream.b.end())
             {
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+                SocketOperation op = _sendStreams.size() > 1 && _transceiver->supportsWritev() ?
+                    writeQueued() : write(_writeStream);
+#else
                 SocketOperation op = write(_writeStream);
+#endif
                 if(op)
                 {
                     return op;
@@ -2927,6 +3092,39 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 {
     assert(_state < StateClosed);
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    SegmentList* segments = 0;
+#endif
+    if(_instance->zeroCopySize() > 0)
+    {
+        //
+        // The byte sequences referenced by the message can only be sent
+        // directly if the message is uncompressed and sent with gather
+        // writes. Otherwise, copy them in the message. A datagram
+        // transceiver sends each buffer of a gather write as a separate
+        // datagram, so the message is always copied. The connection
+        // keeps the sequences until the request is sent or answered.
+        //
+#if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
+        IceInternal::flattenSegments(message.stream);
+#else
+        if(message.compress || !_transceiver->supportsWritev() || _endpoint->datagram() ||
+           _traceLevels->protocol >= 1)
+        {
+            IceInternal::flattenSegments(message.stream);
+        }
+        else
+        {
+            SegmentList taken;
+            if(takeSegments(message.stream, taken))
+            {
+                segments = &_requestSegments[message.stream];
+                segments->swap(taken);
+            }
+        }
+#endif
+    }
+
     message.stream->i = 0; // Reset the message stream iterator before starting sending the message.
 
     if(!_sendStreams.empty())
@@ -2944,18 +3142,10 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     message.stream->i = message.stream->b.begin();
     SocketOperation op;
 #ifdef ICE_HAS_BZIP2
-    if(message.compress && message.stream->b.size() >= 100) // Only compress messages larger than 100 bytes.
+    OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
+    if(message.compress && message.stream->b.size() >= 100 && // Only compress messages larger than 100 bytes.
+       compressMessage(*message.stream, stream))
     {
-        //
-        // Message compressed. Request compressed response, if any.
-        //
-        message.stream->b[9] = 2;
-
-        //
-        // Do compression.
-        //
-        OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
-        doCompress(*message.stream, stream);
         stream.i = stream.b.begin();
 
         traceSend(*message.stream, _logger, _traceLevels);
@@ -2998,13 +3188,17 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
             //
             // Message not compressed. Request compressed response, if any.
             //
-            message.stream->b[9] = 1;
+            message.stream->b[9] = _compressionStatus;
         }
 
         //
         // No compression, just fill in the message size.
         //
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+        Int sz = static_cast<Int>(message.stream->b.size() + (segments ? segments->size() : 0));
+#else
         Int sz = static_cast<Int>(message.stream->b.size());
+#endif
         const Byte* p = reinterpret_cast<const Byte*>(&sz);
 #ifdef ICE_BIG_ENDIAN
         reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
@@ -3018,17 +3212,33 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
         //
         // Send the message without blocking.
         //
-        if(_observer)
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+        if(segments)
         {
-            _observer.startWrite(*message.stream);
+            prepareSegments(*message.stream, *segments);
+            op = writeSegments(*message.stream);
+        }
+        else
+#endif
+        {
+            if(_observer)
+            {
+                _observer.startWrite(*message.stream);
+            }
+            op = write(*message.stream);
         }
-        op = write(*message.stream);
         if(!op)
         {
             if(_observer)
             {
                 _observer.finishWrite(*message.stream);
             }
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+            if(segments && !message.requestId)
+            {
+                _requestSegments.erase(message.stream);
+            }
+#endif
             AsyncStatus status = AsyncStatusSent;
             if(message.sent())
             {
@@ -3053,66 +3263,136 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     return AsyncStatusQueued;
 }
 
-#ifdef ICE_HAS_BZIP2
-static string
-getBZ2Error(int bzError)
+void
+Ice::ConnectionI::prepareMessage(OutgoingMessage& message)
 {
-    if(bzError == BZ_RUN_OK)
-    {
-        return ": BZ_RUN_OK";
-    }
-    else if(bzError == BZ_FLUSH_OK)
-    {
-        return ": BZ_FLUSH_OK";
-    }
-    else if(bzError == BZ_FINISH_OK)
-    {
-        return ": BZ_FINISH_OK";
-    }
-    else if(bzError == BZ_STREAM_END)
-    {
-        return ": BZ_STREAM_END";
-    }
-    else if(bzError == BZ_CONFIG_ERROR)
-    {
-        return ": BZ_CONFIG_ERROR";
-    }
-    else if(bzError == BZ_SEQUENCE_ERROR)
-    {
-        return ": BZ_SEQUENCE_ERROR";
-    }
-    else if(bzError == BZ_PARAM_ERROR)
-    {
-        return ": BZ_PARAM_ERROR";
-    }
-    else if(bzError == BZ_MEM_ERROR)
+    assert(!message.stream->i);
+#ifdef ICE_HAS_BZIP2
+    OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
+    if(message.compress && message.stream->b.size() >= 100 && // Only compress messages > 100 bytes.
+       compressMessage(*message.stream, stream))
     {
-        return ": BZ_MEM_ERROR";
+        traceSend(*message.stream, _logger, _traceLevels);
+
+        message.adopt(&stream); // Adopt the compressed stream.
+        message.stream->i = message.stream->b.begin();
     }
-    else if(bzError == BZ_DATA_ERROR)
+    else
     {
-        return ": BZ_DATA_ERROR";
+#endif
+        if(message.compress)
+        {
+            //
+            // Message not compressed. Request compressed response, if any.
+            //
+            message.stream->b[9] = _compressionStatus;
+        }
+
+        //
+        // No compression, just fill in the message size.
+        //
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+        const SegmentList* segments = getSegments(message.stream);
+        Int sz = static_cast<Int>(message.stream->b.size() + (segments ? segments->size() : 0));
+#else
+        Int sz = static_cast<Int>(message.stream->b.size());
+#endif
+        const Byte* p = reinterpret_cast<const Byte*>(&sz);
+#ifdef ICE_BIG_ENDIAN
+        reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+#else
+        copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+#endif
+        message.stream->i = message.stream->b.begin();
+        traceSend(*message.stream, _logger, _traceLevels);
+
+#ifdef ICE_HAS_BZIP2
     }
-    else if(bzError == BZ_DATA_ERROR_MAGIC)
+#endif
+}
+
+#ifdef ICE_HAS_BZIP2
+bool
+Ice::ConnectionI::compressMessage(OutputStream& uncompressed, OutputStream& compressed)
+{
+    size_t size = uncompressed.b.size();
+
+    //
+    // Messages of a size class whose compression isn't worth its cost
+    // are sent uncompressed. One message out of 16 is still compressed
+    // to detect a change of the payloads.
+    //
+    int sizeClass = 0;
+    while(sizeClass < 15 && (static_cast<size_t>(256) << sizeClass) <= size)
     {
-        return ": BZ_DATA_ERROR_MAGIC";
+        ++sizeClass;
     }
-    else if(bzError == BZ_IO_ERROR)
+    CompressionStats& stats = _compressionStats[sizeClass];
+    if(stats.skip > 0)
     {
-        return ": BZ_IO_ERROR";
+        --stats.skip;
+        if(_observer.compression())
+        {
+            _observer.compression()->compressionSkipped(static_cast<Int>(size));
+        }
+        return false;
     }
-    else if(bzError == BZ_UNEXPECTED_EOF)
+
+    //
+    // Message compressed. Request compressed response, if any.
+    //
+    uncompressed.b[9] = _sendCodec->id();
+
+    //
+    // Do compression.
+    //
+    IceUtil::Time start;
+    if(_adaptiveCompression || _observer.compression())
     {
-        return ": BZ_UNEXPECTED_EOF";
+        start = IceUtil::Time::now(IceUtil::Time::Monotonic);
     }
-    else if(bzError == BZ_OUTBUFF_FULL)
+    doCompress(uncompressed, compressed);
+    if(_adaptiveCompression || _observer.compression())
     {
-        return ": BZ_OUTBUFF_FULL";
+        Long duration = (IceUtil::Time::now(IceUtil::Time::Monotonic) - start).toMicroSeconds();
+        if(_observer.compression())
+        {
+            _observer.compression()->compressed(static_cast<Int>(size), static_cast<Int>(compressed.b.size()),
+                                                duration);
+        }
+
+        if(_adaptiveCompression)
+        {
+            //
+            // The cost of the compression is the time spent compressing
+            // each kilobyte saved. The compression is skipped when its
+            // average cost exceeds the time the connection is expected to
+            // take to send a kilobyte.
+            //
+            size_t saved = compressed.b.size() < size ? size - compressed.b.size() : 0;
+            double cost = static_cast<double>(max(duration, static_cast<Long>(1))) * 1024 /
+                static_cast<double>(max(saved, static_cast<size_t>(1)));
+            stats.cost = stats.cost == 0 ? cost : (stats.cost * 3 + cost) / 4;
+            if(stats.cost > _adaptiveCompressionThreshold)
+            {
+                stats.skip = 15;
+            }
+        }
     }
-    else
+
+    if(compressed.b.size() >= size)
     {
-        return "";
+        //
+        // The compressed message isn't smaller, send the message
+        // uncompressed instead.
+        //
+        if(_observer.compression())
+        {
+            _observer.compression()->compressionSkipped(static_cast<Int>(size));
+        }
+        return false;
     }
+    return true;
 }
 
 void
@@ -3123,18 +3403,12 @@ Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compresse
     //
     // Compress the message body, but not the header.
     //
-    unsigned int uncompressedLen = static_cast<unsigned int>(uncompressed.b.size() - headerSize);
-    unsigned int compressedLen = static_cast<unsigned int>(uncompressedLen * 1.01 + 600);
+    size_t uncompressedLen = uncompressed.b.size() - headerSize;
+    size_t compressedLen = _sendCodec->compressBound(uncompressedLen);
     compressed.b.resize(headerSize + sizeof(Int) + compressedLen);
-    int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(Int),
-                                           &compressedLen,
-                                           reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                           uncompressedLen,
-                                           _compressionLevel, 0, 0);
-    if(bzError != BZ_OK)
-    {
-        throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
-    }
+    compressedLen = _sendCodec->compress(&uncompressed.b[0] + headerSize, uncompressedLen,
+                                         &compressed.b[0] + headerSize + sizeof(Int), compressedLen,
+                                         _compressionLevel);
     compressed.b.resize(headerSize + sizeof(Int) + compressedLen);
 
     //
@@ -3183,20 +3457,17 @@ Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompresse
     {
         Ex::throwMemoryLimitException(__FILE__, __LINE__, uncompressedSize, _messageSizeMax);
     }
-    uncompressed.resize(uncompressedSize);
 
-    unsigned int uncompressedLen = uncompressedSize - headerSize;
-    unsigned int compressedLen = static_cast<unsigned int>(compressed.b.size() - headerSize - sizeof(Int));
-    int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                             &uncompressedLen,
-                                             reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(Int),
-                                             compressedLen,
-                                             0, 0);
-    if(bzError != BZ_OK)
+    const Codec* codec = getCodec(compressed.b[9]);
+    if(!codec)
     {
-        throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
+        throw FeatureNotSupportedException(__FILE__, __LINE__, "Cannot uncompress compressed message");
     }
 
+    uncompressed.resize(uncompressedSize);
+    codec->uncompress(&compressed.b[0] + headerSize + sizeof(Int), compressed.b.size() - headerSize - sizeof(Int),
+                      &uncompressed.b[0] + headerSize, static_cast<size_t>(uncompressedSize - headerSize));
+
     copy(compressed.b.begin(), compressed.b.begin() + headerSize, uncompressed.b.begin());
 }
 #endif
@@ -3237,7 +3508,7 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
         stream.read(messageType);
         stream.read(compress);
 
-        if(compress == 2)
+        if(compress >= bzip2CodecId && !(compress & codecStatusFlag))
         {
 #ifdef ICE_HAS_BZIP2
             InputStream ustream(_instance.get(), Ice::currentProtocolEncoding);
@@ -3247,6 +3518,15 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
             throw FeatureNotSupportedException(__FILE__, __LINE__, "Cannot uncompress compressed message");
 #endif
         }
+
+        //
+        // Use the codec of this connection to compress the messages sent
+        // once the peer shows it supports it.
+        //
+        if(_sendCodec != _codec && _codec && (compress & ~codecStatusFlag) == _codec->id())
+        {
+            _sendCodec = _codec;
+        }
         stream.i = stream.b.begin() + headerSize;
 
         switch(messageType)
@@ -3327,34 +3607,32 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
 
                 stream.read(requestId);
 
-                map<Int, OutgoingAsyncBasePtr>::iterator q = _asyncRequests.end();
-
-                if(_asyncRequestsHint != _asyncRequests.end())
-                {
-                    if(_asyncRequestsHint->first == requestId)
-                    {
-                        q = _asyncRequestsHint;
-                    }
-                }
-
-                if(q == _asyncRequests.end())
-                {
-                    q = _asyncRequests.find(requestId);
-                }
-
+                RequestTable<OutgoingAsyncBasePtr>::iterator q = _asyncRequests.find(requestId);
                 if(q != _asyncRequests.end())
                 {
                     outAsync = q->second;
+                    _asyncRequests.erase(q);
 
-                    if(q == _asyncRequestsHint)
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+                    if(!_requestSegments.empty())
                     {
-                        _asyncRequests.erase(q++);
-                        _asyncRequestsHint = q;
-                    }
-                    else
-                    {
-                        _asyncRequests.erase(q);
+                        //
+                        // The request is sent again from its stream if the reply
+                        // asks for a retry, copy the byte sequences it references.
+                        //
+                        OutputStream* os = outAsync->getOs();
+                        Byte replyStatus = stream.i < stream.b.end() ? *stream.i : replyUnknownException;
+                        if((replyStatus == replyOK || replyStatus == replyUserException) &&
+                           (_sendStreams.empty() || _sendStreams.front().stream != os))
+                        {
+                            _requestSegments.erase(os);
+                        }
+                        else
+                        {
+                            flattenSegments(os);
+                        }
                     }
+#endif
 
                     stream.swap(*outAsync->getIs());
 
@@ -3468,6 +3746,72 @@ Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, B
     }
 }
 
+IceUtil::Time
+Ice::ConnectionI::dispatchDeadline(InputStream& stream, const ServantManagerPtr& servantManager) const
+{
+    //
+    // The dispatch budget of a request is given by the "_deadline" entry
+    // of its context, in milliseconds. Otherwise, it's the budget set for
+    // the operation or the adapter with <adapter>.DispatchDeadline or the
+    // default of the thread pool. Only the first request of a batch is
+    // looked at. The stream isn't consumed, a request which can't be read
+    // here is rejected by the dispatch.
+    //
+    IceUtil::Int64 budget = -1;
+    InputStream::Container::iterator start = stream.i;
+    try
+    {
+        Identity ident;
+        stream.read(ident);
+        vector<string> facet;
+        stream.read(facet);
+        string operation;
+        stream.read(operation, false);
+        Byte mode;
+        stream.read(mode);
+        Int sz = stream.readSize();
+        while(sz--)
+        {
+            string key;
+            string value;
+            stream.read(key);
+            stream.read(value);
+            if(key == "_deadline")
+            {
+                if(!IceUtilInternal::stringToInt64(value, budget) || budget < 0)
+                {
+                    budget = -1;
+                }
+                break;
+            }
+        }
+
+        if(budget < 0 && servantManager)
+        {
+            budget = servantManager->dispatchDeadline(operation);
+        }
+    }
+    catch(const Ice::LocalException&)
+    {
+    }
+    stream.i = start;
+
+    if(budget < 0)
+    {
+        budget = _threadPool->executorDeadline();
+    }
+
+    //
+    // Larger budgets would overflow the conversion to a time, they
+    // are all dispatched after the requests with a smaller budget.
+    //
+    if(budget > maxDispatchBudget)
+    {
+        budget = maxDispatchBudget;
+    }
+    return IceUtil::Time::now(IceUtil::Time::Monotonic) + IceUtil::Time::milliSeconds(budget);
+}
+
 void
 Ice::ConnectionI::scheduleTimeout(SocketOperation status)
 {
@@ -3589,6 +3933,22 @@ ConnectionI::toConnectionState(State state) const
 
 SocketOperation
 ConnectionI::read(Buffer& buf)
+{
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    //
+    // Don't read ahead until the transceiver is initialized, the
+    // buffers are used for the transport handshake until then.
+    //
+    if(!_readAhead.b.empty() && _state > StateNotInitialized)
+    {
+        return readAhead(buf);
+    }
+#endif
+    return doRead(buf);
+}
+
+SocketOperation
+ConnectionI::doRead(Buffer& buf)
 {
     Buffer::Container::iterator start = buf.i;
     SocketOperation op = _transceiver->read(buf);
@@ -3627,6 +3987,296 @@ ConnectionI::write(Buffer& buf)
     return op;
 }
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+SocketOperation
+ConnectionI::readAhead(Buffer& buf)
+{
+    //
+    // First copy the data previously read ahead. If there's still
+    // data left once the buffer is filled, the connection remains
+    // ready for reading and message() is called again to read the
+    // next message without waiting for the selector.
+    //
+    if(_readAheadPos != _readAhead.i)
+    {
+        size_t length = min(static_cast<size_t>(buf.b.end() - buf.i),
+                            static_cast<size_t>(_readAhead.i - _readAheadPos));
+        memcpy(buf.i, _readAheadPos, length);
+        buf.i += length;
+        _readAheadPos += length;
+        if(_readAheadPos != _readAhead.i)
+        {
+            return SocketOperationNone;
+        }
+
+        //
+        // Clear the ready status, the transceiver sets it again from
+        // the read below if it has buffered data.
+        //
+        _threadPool->ready(ICE_SHARED_FROM_THIS, SocketOperationRead, false);
+
+        //
+        // If the data read ahead exactly filled the buffer, don't read
+        // again, the selector reports the connection as readable once
+        // more data is available.
+        //
+        if(buf.i == buf.b.end())
+        {
+            return SocketOperationNone;
+        }
+    }
+
+    //
+    // Read large messages directly into the buffer.
+    //
+    if(static_cast<size_t>(buf.b.end() - buf.i) >= _readAhead.b.size())
+    {
+        return doRead(buf);
+    }
+
+    //
+    // Otherwise, read as much data as possible from the transceiver
+    // and copy what's needed. The read is also performed if the
+    // buffer is already filled to read ahead the next messages.
+    //
+    _readAhead.i = _readAheadPos = _readAhead.b.begin();
+    SocketOperation op = doRead(_readAhead);
+    size_t length = min(static_cast<size_t>(buf.b.end() - buf.i),
+                        static_cast<size_t>(_readAhead.i - _readAheadPos));
+    memcpy(buf.i, _readAheadPos, length);
+    buf.i += length;
+    _readAheadPos += length;
+    if(_readAheadPos != _readAhead.i)
+    {
+        _threadPool->ready(ICE_SHARED_FROM_THIS, SocketOperationRead, true);
+    }
+    return buf.i != buf.b.end() ? op : SocketOperationNone;
+}
+
+SocketOperation
+ConnectionI::writeQueued()
+{
+    //
+    // Prepare the messages queued after the message being sent and write
+    // them along with it using a single system call.
+    //
+    assert(_writeBuffers.empty() && _writePositions.empty());
+    _writeBuffers.push_back(&_writeStream);
+    _writePositions.push_back(_writeStream.i);
+    size_t size = static_cast<size_t>(_writeStream.b.end() - _writeStream.i);
+
+    deque<OutgoingMessage>::iterator p = _sendStreams.begin();
+    for(++p; p != _sendStreams.end() && _writeBuffers.size() < maxGatherMessages && size < maxGatherSize; ++p)
+    {
+        if(getSegments(p->stream))
+        {
+            break; // Messages which reference byte sequences are written on their own.
+        }
+        if(!p->stream->i)
+        {
+            prepareMessage(*p);
+        }
+        _writeBuffers.push_back(p->stream);
+        _writePositions.push_back(p->stream->i);
+        size += static_cast<size_t>(p->stream->b.end() - p->stream->i);
+    }
+
+    SocketOperation op;
+    try
+    {
+        op = _transceiver->writev(_writeBuffers);
+    }
+    catch(...)
+    {
+        _writeBuffers.clear();
+        _writePositions.clear();
+        throw;
+    }
+
+    size_t sent = 0;
+    for(size_t i = 0; i < _writeBuffers.size(); ++i)
+    {
+        size_t n = static_cast<size_t>(_writeBuffers[i]->i - _writePositions[i]);
+        if(i > 0 && n > 0 && _observer)
+        {
+            //
+            // The bytes of the message being sent are accounted for with
+            // finishWrite, account for the bytes of the gathered messages
+            // here.
+            //
+            _observer->sentBytes(static_cast<Int>(n));
+        }
+        sent += n;
+    }
+    _writeBuffers.clear();
+    _writePositions.clear();
+
+    if(_instance->traceLevels()->network >= 3 && sent > 0)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+        out << "sent " << sent << " of " << size << " bytes via " << _endpoint->protocol() << "\n" << toString();
+    }
+
+    //
+    // Only report the operation to wait for if the message being sent
+    // isn't fully written. Otherwise, sendNextMessage notifies it and
+    // continues with the next message, which might be partially written.
+    //
+    return _writeStream.i != _writeStream.b.end() ? op : SocketOperationNone;
+}
+
+void
+ConnectionI::prepareSegments(OutputStream& stream, const SegmentList& segments)
+{
+    //
+    // Describe the message with buffers for the parts of the stream buffer
+    // and for the byte sequences inserted between them. The buffers are
+    // kept with the connection and reused for the next messages.
+    //
+    assert(_segmentCount == 0);
+    OutputStream::size_type pos = 0;
+    for(vector<Segment>::const_iterator p = segments.segments().begin(); p != segments.segments().end(); ++p)
+    {
+        if(p->pos > pos)
+        {
+            addSegmentBuffer(_segmentCount++, &stream.b[0] + pos, &stream.b[0] + p->pos);
+        }
+        addSegmentBuffer(_segmentCount++, p->begin, p->end);
+        pos = p->pos;
+    }
+    if(pos < stream.b.size())
+    {
+        addSegmentBuffer(_segmentCount++, &stream.b[0] + pos, &stream.b[0] + stream.b.size());
+    }
+    stream.i = stream.b.begin();
+}
+
+SocketOperation
+ConnectionI::writeSegments(OutputStream& stream)
+{
+    //
+    // Write the remaining of the message along with the byte sequences
+    // it references using a single system call. The caller of the
+    // synchronous invocation waits for the message to be sent, the
+    // sequences are valid until it's sent or canceled.
+    //
+    assert(_segmentCount > 0 && _writeBuffers.empty());
+    size_t size = 0;
+    for(size_t i = 0; i < _segmentCount; ++i)
+    {
+        Buffer* buf = _segmentBuffers[i];
+        _writeBuffers.push_back(buf);
+        size += static_cast<size_t>(buf->b.end() - buf->i);
+    }
+
+    SocketOperation op;
+    try
+    {
+        op = _transceiver->writev(_writeBuffers);
+    }
+    catch(...)
+    {
+        _writeBuffers.clear();
+        _segmentCount = 0;
+        throw;
+    }
+    _writeBuffers.clear();
+
+    size_t remaining = 0;
+    size_t written = 0;
+    for(size_t i = 0; i < _segmentCount; ++i)
+    {
+        Buffer* buf = _segmentBuffers[i];
+        remaining += static_cast<size_t>(buf->b.end() - buf->i);
+        written += static_cast<size_t>(buf->i - buf->b.begin());
+    }
+
+    size_t sent = size - remaining;
+    if(sent > 0)
+    {
+        if(_observer)
+        {
+            _observer->sentBytes(static_cast<Int>(sent));
+        }
+        if(_instance->traceLevels()->network >= 3)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "sent " << sent << " of " << size << " bytes via " << _endpoint->protocol() << "\n" << toString();
+        }
+    }
+
+    //
+    // The stream iterator only tells whether the message is partially
+    // or fully written.
+    //
+    if(remaining > 0)
+    {
+        assert(op);
+        stream.i = stream.b.begin() + min(written, stream.b.size() - 1);
+        return op;
+    }
+    stream.i = stream.b.end();
+    _segmentCount = 0;
+    return SocketOperationNone;
+}
+
+SegmentList*
+ConnectionI::getSegments(OutputStream* stream)
+{
+    if(_requestSegments.empty())
+    {
+        return 0;
+    }
+    map<OutputStream*, SegmentList>::iterator p = _requestSegments.find(stream);
+    return p != _requestSegments.end() ? &p->second : 0;
+}
+
+void
+ConnectionI::flattenSegments(OutputStream* stream)
+{
+    //
+    // Copy the byte sequences referenced by the request in its stream. If
+    // the request is being written, it's in the write stream and it
+    // continues to be written from there.
+    //
+    map<OutputStream*, SegmentList>::iterator p = _requestSegments.find(stream);
+    if(p == _requestSegments.end())
+    {
+        return;
+    }
+
+    if(!_writeStream.b.empty() && !_sendStreams.empty() && _sendStreams.front().stream == stream)
+    {
+        bool written = _segmentCount == 0;
+        size_t pos = 0;
+        for(size_t i = 0; i < _segmentCount; ++i)
+        {
+            Buffer* buf = _segmentBuffers[i];
+            pos += static_cast<size_t>(buf->i - buf->b.begin());
+        }
+        _segmentCount = 0;
+        p->second.flatten(_writeStream);
+        _writeStream.i = written ? _writeStream.b.end() : _writeStream.b.begin() + pos;
+    }
+    else
+    {
+        p->second.flatten(*stream);
+    }
+    _requestSegments.erase(p);
+}
+
+void
+ConnectionI::addSegmentBuffer(size_t n, const Byte* begin, const Byte* end)
+{
+    if(n == _segmentBuffers.size())
+    {
+        _segmentBuffers.push_back(new Buffer());
+    }
+    Buffer data(begin, end);
+    _segmentBuffers[n]->swapBuffer(data);
+}
+#endif
+
 void
 ConnectionI::reap()
 {
@@ -40,14 +40,13 @@
 #include <Ice/ACM.h>
 #include <Ice/OutputStream.h>
 #include <Ice/InputStream.h>
+#include <Ice/Codec.h>
+#include <Ice/CompressionObserver.h>
+#include <Ice/RequestTable.h>
+#include <Ice/Segments.h>
 
 #include <deque>
-
-#if !defined(ICE_OS_UWP)
-#    ifndef ICE_HAS_BZIP2
-#        define ICE_HAS_BZIP2
-#    endif
-#endif
+#include <map>
 
 namespace Ice
 {
@@ -74,11 +73,22 @@ class ConnectionI : public Connection,
         void finishWrite(const IceInternal::Buffer&);
 
         void attach(const Ice::Instrumentation::ConnectionObserverPtr&);
+        void detach();
+
+        //
+        // The compression observer interface of the observer, if it
+        // implements it.
+        //
+        IceInternal::CompressionObserver* compression() const
+        {
+            return _compression;
+        }
 
     private:
 
         Ice::Byte* _readStreamPos;
         Ice::Byte* _writeStreamPos;
+        IceInternal::CompressionObserver* _compression;
     };
 
 public:
@@ -159,6 +169,7 @@ public:
     virtual void close(ConnectionClose); // From Connection.
 
     bool isActiveOrHolding() const;
+    size_t getOutstandingRequests() const; // The number of requests waiting to be sent or for a response.
     bool isFinished() const;
 
     virtual void throwException() const; // From Connection. Throws the connection exception if destroyed.
@@ -168,7 +179,7 @@ public:
 
     void updateObserver();
 
-    void monitor(const IceUtil::Time&, const IceInternal::ACMConfig&);
+    IceUtil::Time monitor(const IceUtil::Time&, const IceInternal::ACMConfig&);
 
     IceInternal::AsyncStatus sendAsyncRequest(const IceInternal::OutgoingAsyncBasePtr&, bool, bool, int);
 
@@ -295,8 +306,10 @@ private:
     bool validate(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
     IceInternal::SocketOperation sendNextMessage(std::vector<OutgoingMessage>&);
     IceInternal::AsyncStatus sendMessage(OutgoingMessage&);
+    void prepareMessage(OutgoingMessage&);
 
 #ifdef ICE_HAS_BZIP2
+    bool compressMessage(Ice::OutputStream&, Ice::OutputStream&);
     void doCompress(Ice::OutputStream&, Ice::OutputStream&);
     void doUncompress(Ice::InputStream&, Ice::InputStream&);
 #endif
@@ -308,6 +321,8 @@ private:
     void invokeAll(Ice::InputStream&, Int, Int, Byte,
                    const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&);
 
+    IceUtil::Time dispatchDeadline(Ice::InputStream&, const IceInternal::ServantManagerPtr&) const;
+
     void scheduleTimeout(IceInternal::SocketOperation status);
     void unscheduleTimeout(IceInternal::SocketOperation status);
 
@@ -315,7 +330,17 @@ private:
     Ice::Instrumentation::ConnectionState toConnectionState(State) const;
 
     IceInternal::SocketOperation read(IceInternal::Buffer&);
+    IceInternal::SocketOperation doRead(IceInternal::Buffer&);
     IceInternal::SocketOperation write(IceInternal::Buffer&);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    IceInternal::SocketOperation readAhead(IceInternal::Buffer&);
+    IceInternal::SocketOperation writeQueued();
+    IceInternal::SegmentList* getSegments(Ice::OutputStream*);
+    void prepareSegments(Ice::OutputStream&, const IceInternal::SegmentList&);
+    IceInternal::SocketOperation writeSegments(Ice::OutputStream&);
+    void flattenSegments(Ice::OutputStream*);
+    void addSegmentBuffer(size_t, const Ice::Byte*, const Ice::Byte*);
+#endif
 
     void reap();
 
@@ -357,13 +382,34 @@ private:
     const bool _warnUdp;
 
     IceUtil::Time _acmLastActivity;
+    bool _acmUnscheduled; // True if the ACM monitor waits for a dispatch or an invocation to monitor again.
 
     const int _compressionLevel;
+    const IceInternal::Codec* _codec; // The codec used if the peer supports it.
+    const IceInternal::Codec* _sendCodec; // The codec used to compress the messages sent.
+    const Byte _compressionStatus; // The compression status of uncompressed messages.
+
+    //
+    // The cost of the compression of the messages sent, in microseconds
+    // per kilobyte saved, tracked by message size class to skip the
+    // compression when it isn't worth its cost.
+    //
+    struct CompressionStats
+    {
+        CompressionStats() : cost(0), skip(0)
+        {
+        }
+
+        double cost;
+        int skip;
+    };
+    const bool _adaptiveCompression;
+    const double _adaptiveCompressionThreshold;
+    CompressionStats _compressionStats[16];
 
     Int _nextRequestId;
 
-    std::map<Int, IceInternal::OutgoingAsyncBasePtr> _asyncRequests;
-    std::map<Int, IceInternal::OutgoingAsyncBasePtr>::iterator _asyncRequestsHint;
+    IceInternal::RequestTable<IceInternal::OutgoingAsyncBasePtr> _asyncRequests;
 
     IceInternal::UniquePtr<LocalException> _exception;
 
@@ -374,7 +420,18 @@ private:
 
     Ice::InputStream _readStream;
     bool _readHeader;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    IceInternal::Buffer _readAhead;
+    IceInternal::Buffer::Container::iterator _readAheadPos;
+#endif
     Ice::OutputStream _writeStream;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    std::vector<IceInternal::Buffer*> _writeBuffers;
+    std::vector<IceInternal::Buffer::Container::iterator> _writePositions;
+    std::vector<IceInternal::Buffer*> _segmentBuffers;
+    size_t _segmentCount; // The number of segment buffers of the message being written, 0 if none.
+    std::map<Ice::OutputStream*, IceInternal::SegmentList> _requestSegments; // Keyed by the request stream.
+#endif
 
     Observer _observer;
 
@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/ImplicitContextI.h>
+#include <Ice/BufferPool.h>
 #include <Ice/Service.h>
 
 extern "C" BOOL WINAPI _CRT_INIT(HINSTANCE, DWORD, LPVOID);
@@ -36,6 +37,7 @@ ice_DLL_Main(HINSTANCE hDLL, DWORD reason, LPVOID reserved)
     else if(reason == DLL_THREAD_DETACH)
     {
         Ice::ImplicitContextI::cleanupThread();
+        IceInternal::cleanupBufferPoolThread();
     }
 
     //
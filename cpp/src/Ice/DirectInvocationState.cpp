@@ -0,0 +1,116 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/DirectInvocationState.h>
+
+#ifdef ICE_CPP11_MAPPING
+
+#include <Ice/OutgoingAsync.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// The direct invocations of the thread, the innermost first. A servant
+// dispatched directly can itself make direct invocations.
+//
+thread_local DirectInvocationState* currentState = 0;
+
+}
+
+IceInternal::DirectInvocationState::DirectInvocationState(OutgoingAsync* out,
+                                                          DirectInvocation* inv,
+                                                          const function<void(OutputStream*)>& w,
+                                                          const EncodingVersion& enc,
+                                                          FormatType fmt) :
+    outAsync(out),
+    invocation(inv),
+    write(w),
+    encoding(enc),
+    format(fmt),
+    marshaled(false),
+    completed(false),
+    incoming(0),
+    _previous(currentState)
+{
+    currentState = this;
+}
+
+IceInternal::DirectInvocationState::~DirectInvocationState()
+{
+    assert(currentState == this);
+    currentState = _previous;
+}
+
+DirectInvocationState*
+IceInternal::DirectInvocationState::current(const OutgoingAsyncBase* out)
+{
+    for(DirectInvocationState* p = currentState; p; p = p->_previous)
+    {
+        if(p->outAsync == out)
+        {
+            return p;
+        }
+    }
+    return 0;
+}
+
+DirectInvocationState*
+IceInternal::DirectInvocationState::pending(const OutgoingAsyncBase* out)
+{
+    DirectInvocationState* state = current(out);
+    return state && !state->marshaled ? state : 0;
+}
+
+DirectInvocationState*
+IceInternal::DirectInvocationState::dispatched(const Incoming* in)
+{
+    for(DirectInvocationState* p = currentState; p; p = p->_previous)
+    {
+        if(p->incoming == in)
+        {
+            return p->marshaled ? 0 : p;
+        }
+    }
+    return 0;
+}
+
+void
+IceInternal::DirectInvocationState::marshal(const OutgoingAsyncBase* out)
+{
+    DirectInvocationState* state = pending(out);
+    if(state)
+    {
+        state->marshal();
+    }
+}
+
+void
+IceInternal::DirectInvocationState::marshal()
+{
+    assert(!marshaled);
+    OutputStream* os = outAsync->getOs();
+    if(write)
+    {
+        os->startEncapsulation(encoding, format);
+        write(os);
+        os->endEncapsulation();
+    }
+    else
+    {
+        os->writeEmptyEncapsulation(encoding);
+    }
+    marshaled = true;
+}
+
+#endif
@@ -0,0 +1,99 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_DIRECT_INVOCATION_STATE_H
+#define ICE_DIRECT_INVOCATION_STATE_H
+
+#include <Ice/Config.h>
+
+#ifdef ICE_CPP11_MAPPING
+
+#include <Ice/DirectInvocation.h>
+#include <Ice/InputStream.h>
+#include <Ice/Format.h>
+#include <Ice/Version.h>
+
+#include <functional>
+
+namespace IceInternal
+{
+
+class OutgoingAsyncBase;
+class OutgoingAsync;
+class Incoming;
+
+//
+// The state of a direct invocation, see Ice.CollocationDirect. It's
+// created on the stack of the invoking thread by OutgoingAsync::invoke
+// and registered with the thread for the duration of the call, the
+// invocation doesn't hold it. The state of the invocation is found
+// with current().
+//
+class DirectInvocationState : private IceUtil::noncopyable
+{
+public:
+
+    DirectInvocationState(OutgoingAsync*, DirectInvocation*, const std::function<void(Ice::OutputStream*)>&,
+                          const Ice::EncodingVersion&, Ice::FormatType);
+    ~DirectInvocationState();
+
+    //
+    // Returns the state of the direct invocation of the calling thread
+    // for the given invocation, or null if the invocation isn't a direct
+    // invocation.
+    //
+    static DirectInvocationState* current(const OutgoingAsyncBase*);
+
+    //
+    // Returns the state of the given invocation if its parameters
+    // aren't marshaled yet, or null otherwise.
+    //
+    static DirectInvocationState* pending(const OutgoingAsyncBase*);
+
+    //
+    // Returns the state of the direct invocation dispatched by the given
+    // request if its parameters aren't marshaled yet, or null otherwise.
+    //
+    static DirectInvocationState* dispatched(const Incoming*);
+
+    //
+    // Marshal the parameters in the request, if they aren't marshaled
+    // yet, when the request can't be dispatched directly. It's a no-op
+    // for other invocations.
+    //
+    static void marshal(const OutgoingAsyncBase*);
+    void marshal();
+
+    OutgoingAsync* const outAsync;
+    DirectInvocation* const invocation;
+    const std::function<void(Ice::OutputStream*)>& write;
+    const Ice::EncodingVersion encoding;
+    const Ice::FormatType format;
+
+    bool marshaled; // True once the parameters are marshaled in the request.
+    bool completed; // True if the servant wrote its results in the invocation.
+
+    const Incoming* incoming; // The request dispatching the invocation, null if not dispatched.
+
+    //
+    // The stream used by the dispatch to read the parameters once they
+    // are marshaled.
+    //
+    std::unique_ptr<Ice::InputStream> is;
+
+private:
+
+    DirectInvocationState* _previous;
+};
+
+}
+
+#endif
+
+#endif
@@ -22,6 +22,8 @@
 #include <Ice/Protocol.h>
 #include <Ice/ReplyStatus.h>
 #include <Ice/ResponseHandler.h>
+#include <Ice/OutgoingAsync.h>
+#include <Ice/DirectInvocationState.h>
 #include <Ice/StringUtil.h>
 #include <typeinfo>
 
@@ -45,6 +47,11 @@ Ice::MarshaledResult::MarshaledResult(const Ice::Current& current) :
     ostr->write(current.requestId);
     ostr->write(replyOK);
 }
+
+IceInternal::DirectInvocation::~DirectInvocation()
+{
+    // Out of line to avoid weak vtable
+}
 #endif
 
 IceInternal::IncomingBase::IncomingBase(Instance* instance, ResponseHandler* responseHandler,
@@ -588,6 +595,10 @@ IceInternal::Incoming::pop()
 void
 IceInternal::Incoming::startOver()
 {
+#ifdef ICE_CPP11_MAPPING
+    marshalDirectParams();
+#endif
+
     if(_inParamPos == 0)
     {
         //
@@ -610,6 +621,60 @@ IceInternal::Incoming::startOver()
     }
 }
 
+#ifdef ICE_CPP11_MAPPING
+void
+IceInternal::Incoming::setDirectInvocation(DirectInvocationState* direct)
+{
+    if(direct)
+    {
+        direct->incoming = this;
+    }
+}
+
+DirectInvocation*
+IceInternal::Incoming::startDirectParams()
+{
+    DirectInvocationState* direct = DirectInvocationState::dispatched(this);
+    if(!direct)
+    {
+        return 0;
+    }
+    _current.encoding = direct->encoding;
+    return direct->invocation;
+}
+
+void
+IceInternal::Incoming::endDirectParams()
+{
+    DirectInvocationState* direct = DirectInvocationState::dispatched(this);
+    assert(direct);
+    direct->completed = true;
+    writeEmptyParams();
+}
+
+void
+IceInternal::Incoming::marshalDirectParams()
+{
+    //
+    // The servant doesn't use the parameters of the direct invocation,
+    // marshal them at the end of the request and read them from there.
+    // The stream may be reallocated, the input stream is re-created.
+    //
+    DirectInvocationState* direct = DirectInvocationState::dispatched(this);
+    if(!direct)
+    {
+        return;
+    }
+    direct->incoming = 0;
+
+    InputStream::size_type pos = _is->pos();
+    direct->marshal();
+    direct->is.reset(new InputStream(_is->instance(), _is->getEncoding(), *direct->outAsync->getOs()));
+    direct->is->pos(pos);
+    _is = direct->is.get();
+}
+#endif
+
 void
 IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStream* stream)
 {
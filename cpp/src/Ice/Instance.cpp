@@ -44,6 +44,9 @@
 #include <Ice/ObserverHelper.h>
 #include <Ice/Functional.h>
 #include <Ice/ConsoleUtil.h>
+#include <Ice/BufferPool.h>
+#include <Ice/Codec.h>
+#include <Ice/ThreadAffinity.h>
 
 #include <IceUtil/DisableWarnings.h>
 #include <IceUtil/FileUtil.h>
@@ -188,6 +191,34 @@ private:
     const InstancePtr _instance;
 };
 
+//
+// Binds the timer thread to the CPUs of Ice.ThreadAffinity, it's the first
+// task run by the timer.
+//
+class BindTimerThread : public IceUtil::TimerTask
+{
+public:
+
+    BindTimerThread(const Ice::LoggerPtr& logger, const vector<int>& cpus) : _logger(logger), _cpus(cpus)
+    {
+    }
+
+    virtual void runTimerTask()
+    {
+        string error;
+        if(!setThreadAffinity(_cpus, error))
+        {
+            Warning out(_logger);
+            out << "cannot bind timer thread to CPUs " << threadAffinityToString(_cpus) << ":\n" << error;
+        }
+    }
+
+private:
+
+    const Ice::LoggerPtr _logger;
+    const vector<int> _cpus;
+};
+
 //
 // Timer specialization which supports the thread observer
 //
@@ -947,9 +978,15 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
     _initData(initData),
     _messageSizeMax(0),
     _batchAutoFlushSize(0),
+    _batchAutoFlushDelay(0),
+    _zeroCopySize(0),
+    _collocationDirect(false),
     _classGraphDepthMax(0),
     _collectObjects(false),
     _toStringMode(ICE_ENUM(ToStringMode, Unicode)),
+    _hasBufferPoolLimits(false),
+    _bufferPoolThreadCacheSize(0),
+    _bufferPoolSize(0),
     _implicitContext(0),
     _stringConverter(Ice::getProcessStringConverter()),
     _wstringConverter(Ice::getProcessWstringConverter()),
@@ -1175,6 +1212,33 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
             }
         }
 
+        // Property is in microseconds, a value of 0 or less disables the flush of batches after a delay.
+        const_cast<Int&>(_batchAutoFlushDelay) =
+            max(_initData.properties->getPropertyAsIntWithDefault("Ice.BatchAutoFlushDelay", 0), 0);
+
+        {
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.ZeroCopySize", 0);
+            if(num > 0)
+            {
+                if(static_cast<size_t>(num) > static_cast<size_t>(0x7fffffff / 1024))
+                {
+                    const_cast<size_t&>(_zeroCopySize) = static_cast<size_t>(0x7fffffff);
+                }
+                else
+                {
+                    // Property is in kilobytes, convert in bytes.
+                    const_cast<size_t&>(_zeroCopySize) = static_cast<size_t>(num) * 1024;
+                }
+            }
+        }
+
+        //
+        // Collocated servants are dispatched from the thread of synchronous invocations unless
+        // there's a dispatcher. The requests must be marshaled for protocol tracing.
+        //
+        const_cast<bool&>(_collocationDirect) = _initData.properties->getPropertyAsInt("Ice.CollocationDirect") > 0 &&
+            !_initData.dispatcher && _traceLevels->protocol < 1;
+
         {
             static const int defaultValue = 100;
             Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.ClassGraphDepthMax", defaultValue);
@@ -1188,6 +1252,23 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
             }
         }
 
+        //
+        // The buffer pool is shared by all the communicators of the process, it uses the
+        // largest limits configured by the communicators until they are destroyed.
+        //
+        if(!_initData.properties->getProperty("Ice.BufferPool.ThreadCacheSize").empty() ||
+           !_initData.properties->getProperty("Ice.BufferPool.Size").empty())
+        {
+            // Properties are in kilobytes.
+            Int threadCacheSize = _initData.properties->getPropertyAsIntWithDefault("Ice.BufferPool.ThreadCacheSize",
+                                                                                    256);
+            Int poolSize = _initData.properties->getPropertyAsIntWithDefault("Ice.BufferPool.Size", 4096);
+            _bufferPoolThreadCacheSize = static_cast<size_t>(max(threadCacheSize, 0)) * 1024;
+            _bufferPoolSize = static_cast<size_t>(max(poolSize, 0)) * 1024;
+            addBufferPoolLimits(_bufferPoolThreadCacheSize, _bufferPoolSize);
+            _hasBufferPoolLimits = true;
+        }
+
         const_cast<bool&>(_collectObjects) = _initData.properties->getPropertyAsInt("Ice.CollectObjects") > 0;
 
         string toStringModeStr = _initData.properties->getPropertyWithDefault("Ice.ToStringMode", "Unicode");
@@ -1204,6 +1285,19 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
             throw InitializationException(__FILE__, __LINE__, "The value for Ice.ToStringMode must be Unicode, ASCII or Compat");
         }
 
+        string codec = _initData.properties->getProperty("Ice.Compression.Codec");
+        if(!codec.empty() && !getCodec(codec))
+        {
+            throw InitializationException(__FILE__, __LINE__, "compression codec `" + codec + "' is not supported");
+        }
+
+        string selection = _initData.properties->getPropertyWithDefault("Ice.ConnectionPool.Selection", "RoundRobin");
+        if(selection != "RoundRobin" && selection != "LeastOutstanding")
+        {
+            throw InitializationException(__FILE__, __LINE__, "The value for Ice.ConnectionPool.Selection must be "
+                                          "RoundRobin or LeastOutstanding");
+        }
+
         //
         // Client ACM enabled by default. Server ACM disabled by default.
         //
@@ -1446,6 +1540,21 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
         {
             _timer = new Timer;
         }
+
+        string affinity = _initData.properties->getProperty("Ice.ThreadAffinity");
+        if(!affinity.empty())
+        {
+            vector<int> cpus;
+            if(parseThreadAffinity(affinity, cpus))
+            {
+                _timer->schedule(ICE_MAKE_SHARED(BindTimerThread, _initData.logger, cpus), IceUtil::Time());
+            }
+            else
+            {
+                Warning out(_initData.logger);
+                out << "invalid value for Ice.ThreadAffinity: `" << affinity << "'; timer thread isn't bound to CPUs";
+            }
+        }
     }
     catch(const IceUtil::Exception& ex)
     {
@@ -1675,6 +1784,22 @@ IceInternal::Instance::destroy()
         _endpointFactoryManager->destroy();
     }
 
+    if(_hasBufferPoolLimits)
+    {
+        removeBufferPoolLimits(_bufferPoolThreadCacheSize, _bufferPoolSize);
+        _hasBufferPoolLimits = false;
+    }
+
+    if(_traceLevels->bufferPool >= 1)
+    {
+        BufferPoolStats stats = getBufferPoolStats();
+        Trace out(_initData.logger, _traceLevels->bufferPoolCat);
+        out << "buffer pool statistics:";
+        out << "\nallocations = " << stats.allocations;
+        out << "\ncache hits = " << stats.hits;
+        out << "\ncached bytes = " << stats.cached;
+    }
+
     if(_initData.properties->getPropertyAsInt("Ice.Warn.UnusedProperties") > 0)
     {
         set<string> unusedProperties = static_cast<PropertiesI*>(_initData.properties.get())->getUnusedProperties();
@@ -108,6 +108,9 @@ public:
     Ice::PluginManagerPtr pluginManager() const;
     size_t messageSizeMax() const { return _messageSizeMax; }
     size_t batchAutoFlushSize() const { return _batchAutoFlushSize; }
+    Ice::Int batchAutoFlushDelay() const { return _batchAutoFlushDelay; }
+    size_t zeroCopySize() const { return _zeroCopySize; }
+    bool collocationDirect() const { return _collocationDirect; }
     size_t classGraphDepthMax() const { return _classGraphDepthMax; }
     bool collectObjects() const { return _collectObjects; }
     Ice::ToStringMode toStringMode() const { return _toStringMode; }
@@ -177,9 +180,15 @@ private:
     const DefaultsAndOverridesPtr _defaultsAndOverrides; // Immutable, not reset by destroy().
     const size_t _messageSizeMax; // Immutable, not reset by destroy().
     const size_t _batchAutoFlushSize; // Immutable, not reset by destroy().
+    const Ice::Int _batchAutoFlushDelay; // Immutable, not reset by destroy().
+    const size_t _zeroCopySize; // Immutable, not reset by destroy().
+    const bool _collocationDirect; // Immutable, not reset by destroy().
     const size_t _classGraphDepthMax; // Immutable, not reset by destroy().
     const bool _collectObjects; // Immutable, not reset by destroy().
     const Ice::ToStringMode _toStringMode; // Immutable, not reset by destroy()
+    bool _hasBufferPoolLimits;
+    size_t _bufferPoolThreadCacheSize;
+    size_t _bufferPoolSize;
     ACMConfig _clientACM;
     ACMConfig _serverACM;
     RouterManagerPtr _routerManager;
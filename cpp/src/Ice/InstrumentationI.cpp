@@ -15,6 +15,9 @@
 #include <Ice/LocalException.h>
 #include <Ice/Communicator.h>
 #include <Ice/LoggerUtil.h>
+#include <Ice/BufferPool.h>
+#include <Ice/BufferPoolMetrics.h>
+#include <Ice/ConnectionCompressionMetrics.h>
 
 using namespace std;
 using namespace Ice;
@@ -72,6 +75,42 @@ struct ThreadStateChanged
     ThreadState newState;
 };
 
+struct Compressed
+{
+    Compressed(Int size, Int compressedSize, Long duration) :
+        size(size), compressedSize(compressedSize), duration(duration)
+    {
+    }
+
+    void operator()(const ConnectionCompressionMetricsPtr& v)
+    {
+        ++v->compressed;
+        v->compressionInputBytes += size;
+        v->compressionOutputBytes += compressedSize;
+        v->compressionTime += duration;
+    }
+
+    Int size;
+    Int compressedSize;
+    Long duration;
+};
+
+struct BufferPoolStatsUpdated
+{
+    BufferPoolStatsUpdated(const BufferPoolStats& stats) : stats(stats)
+    {
+    }
+
+    void operator()(const BufferPoolMetricsPtr& v)
+    {
+        v->allocations = stats.allocations;
+        v->hits = stats.hits;
+        v->cachedBytes = stats.cached;
+    }
+
+    BufferPoolStats stats;
+};
+
 IPConnectionInfo*
 getIPConnectionInfo(const ConnectionInfoPtr& info)
 {
@@ -86,7 +125,7 @@ getIPConnectionInfo(const ConnectionInfoPtr& info)
     return ICE_NULLPTR;
 }
 
-class ConnectionHelper : public MetricsHelperT<ConnectionMetrics>
+class ConnectionHelper : public MetricsHelperT<ConnectionCompressionMetrics>
 {
 public:
 
@@ -700,6 +739,83 @@ private:
 
 ThreadHelper::Attributes ThreadHelper::attributes;
 
+class BufferPoolHelper : public MetricsHelperT<BufferPoolMetrics>
+{
+public:
+
+    class Attributes : public AttributeResolverT<BufferPoolHelper>
+    {
+    public:
+
+        Attributes()
+        {
+            add("parent", &BufferPoolHelper::getParent);
+            add("id", &BufferPoolHelper::getId);
+        }
+    };
+    static Attributes attributes;
+
+    virtual string operator()(const string& attribute) const
+    {
+        return attributes(this, attribute);
+    }
+
+    string getParent() const
+    {
+        return "Communicator";
+    }
+
+    string getId() const
+    {
+        return "BufferPool";
+    }
+};
+
+BufferPoolHelper::Attributes BufferPoolHelper::attributes;
+
+//
+// Registers the BufferPool map and refreshes its single entry with the
+// statistics of the pool.
+//
+class BufferPoolUpdater : public Updater
+{
+public:
+
+    BufferPoolUpdater(const MetricsAdminIPtr& metrics) : _factory(metrics, "BufferPool")
+    {
+    }
+
+    virtual void
+    update()
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_factory.isEnabled())
+        {
+            //
+            // The observer keeps the buffer pool metrics attached, it's
+            // only updated if the maps are reconfigured.
+            //
+            _observer = _factory.getObserver(BufferPoolHelper(), _observer);
+            if(_observer)
+            {
+                _observer->attach();
+                _observer->forEach(BufferPoolStatsUpdated(getBufferPoolStats()));
+            }
+        }
+        else if(_observer)
+        {
+            _observer->detach();
+            _observer = ICE_NULLPTR;
+        }
+    }
+
+private:
+
+    IceUtil::Mutex _mutex;
+    ObserverFactoryT<ObserverT<BufferPoolMetrics> > _factory;
+    ICE_INTERNAL_HANDLE<ObserverT<BufferPoolMetrics> > _observer;
+};
+
 class EndpointHelper : public MetricsHelperT<Metrics>
 {
 public:
@@ -793,6 +909,23 @@ ConnectionObserverI::receivedBytes(Int num)
     }
 }
 
+void
+ConnectionObserverI::compressed(Int size, Int compressedSize, Long duration)
+{
+    forEach(Compressed(size, compressedSize, duration));
+}
+
+void
+ConnectionObserverI::compressionSkipped(Int)
+{
+    forEach(inc(&ConnectionCompressionMetrics::compressionSkipped));
+}
+
+IceInternal::CompressionObserver::~CompressionObserver()
+{
+    // Out of line to avoid weak vtable
+}
+
 void
 ThreadObserverI::stateChanged(ThreadState oldState, ThreadState newState)
 {
@@ -907,8 +1040,43 @@ InvocationObserverI::getCollocatedObserver(const Ice::ObjectAdapterPtr& adapter,
     return ICE_NULLPTR;
 }
 
+CommunicatorMetricsAdminI::CommunicatorMetricsAdminI(const PropertiesPtr& properties, const LoggerPtr& logger) :
+    MetricsAdminI(properties, logger)
+{
+}
+
+void
+CommunicatorMetricsAdminI::setBufferPoolUpdater(const UpdaterPtr& updater)
+{
+    UpdaterPtr previous;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        previous = _bufferPoolUpdater;
+        _bufferPoolUpdater = updater;
+    }
+}
+
+MetricsView
+#ifdef ICE_CPP11_MAPPING
+CommunicatorMetricsAdminI::getMetricsView(string viewName, Long& timestamp, const Current& current)
+#else
+CommunicatorMetricsAdminI::getMetricsView(const string& viewName, Long& timestamp, const Current& current)
+#endif
+{
+    UpdaterPtr updater;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        updater = _bufferPoolUpdater;
+    }
+    if(updater)
+    {
+        updater->update();
+    }
+    return MetricsAdminI::getMetricsView(viewName, timestamp, current);
+}
+
 CommunicatorObserverI::CommunicatorObserverI(const InitializationData& initData) :
-    _metrics(new MetricsAdminI(initData.properties, initData.logger)),
+    _metrics(ICE_MAKE_SHARED(CommunicatorMetricsAdminI, initData.properties, initData.logger)),
     _delegate(initData.observer),
     _connections(_metrics, "Connection"),
     _dispatch(_metrics, "Dispatch"),
@@ -919,6 +1087,7 @@ CommunicatorObserverI::CommunicatorObserverI(const InitializationData& initData)
 {
     _invocations.registerSubMap<RemoteMetrics>("Remote", &InvocationMetrics::remotes);
     _invocations.registerSubMap<CollocatedMetrics>("Collocated", &InvocationMetrics::collocated);
+    _metrics->setBufferPoolUpdater(ICE_MAKE_SHARED(BufferPoolUpdater, _metrics));
 }
 
 void
@@ -1078,7 +1247,7 @@ CommunicatorObserverI::getDispatchObserver(const Current& current, int size)
     return ICE_NULLPTR;
 }
 
-const IceInternal::MetricsAdminIPtr&
+IceInternal::MetricsAdminIPtr
 CommunicatorObserverI::getFacet() const
 {
     assert(_metrics);
@@ -1095,5 +1264,6 @@ CommunicatorObserverI::destroy()
     _connects.destroy();
     _endpointLookups.destroy();
 
+    _metrics->setBufferPoolUpdater(ICE_NULLPTR); // Break cyclic reference count.
     _metrics->destroy();
 }
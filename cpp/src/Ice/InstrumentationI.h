@@ -12,6 +12,17 @@
 
 #include <Ice/MetricsObserverI.h>
 #include <Ice/Connection.h>
+#include <Ice/CompressionObserver.h>
+
+namespace IceMX
+{
+
+class ConnectionCompressionMetrics;
+#ifndef ICE_CPP11_MAPPING
+ICE_API ::Ice::Object* upCast(ConnectionCompressionMetrics*);
+#endif
+
+}
 
 namespace IceInternal
 {
@@ -151,13 +162,17 @@ void addConnectionAttributes(typename Helper::Attributes& attrs)
     addEndpointAttributes<Helper>(attrs);
 }
 
-class ConnectionObserverI : public ObserverWithDelegateT<IceMX::ConnectionMetrics,
-                                                         Ice::Instrumentation::ConnectionObserver>
+class ConnectionObserverI : public ObserverWithDelegateT<IceMX::ConnectionCompressionMetrics,
+                                                         Ice::Instrumentation::ConnectionObserver>,
+                            public IceInternal::CompressionObserver
 {
 public:
 
     virtual void sentBytes(Ice::Int);
     virtual void receivedBytes(Ice::Int);
+
+    virtual void compressed(Ice::Int, Ice::Int, Ice::Long);
+    virtual void compressionSkipped(Ice::Int);
 };
 
 class ThreadObserverI : public ObserverWithDelegateT<IceMX::ThreadMetrics, Ice::Instrumentation::ThreadObserver>
@@ -209,6 +224,32 @@ public:
 
 typedef ObserverWithDelegateT<IceMX::Metrics, Ice::Instrumentation::Observer> ObserverI;
 
+//
+// The metrics admin facet of the communicator observer. The buffer pool
+// metrics are updated with the statistics of the pool by the given updater
+// when a metrics view is retrieved rather than on each allocation.
+//
+class CommunicatorMetricsAdminI : public MetricsAdminI
+{
+public:
+
+    CommunicatorMetricsAdminI(const Ice::PropertiesPtr&, const Ice::LoggerPtr&);
+
+    void setBufferPoolUpdater(const IceMX::UpdaterPtr&);
+
+#ifdef ICE_CPP11_MAPPING
+    virtual IceMX::MetricsView getMetricsView(std::string, Ice::Long&, const Ice::Current&);
+#else
+    virtual IceMX::MetricsView getMetricsView(const std::string&, Ice::Long&, const Ice::Current&);
+#endif
+
+private:
+
+    IceUtil::Mutex _mutex;
+    IceMX::UpdaterPtr _bufferPoolUpdater;
+};
+ICE_DEFINE_PTR(CommunicatorMetricsAdminIPtr, CommunicatorMetricsAdminI);
+
 class ICE_API CommunicatorObserverI : public Ice::Instrumentation::CommunicatorObserver
 {
 public:
@@ -238,13 +279,13 @@ public:
 
     virtual Ice::Instrumentation::DispatchObserverPtr getDispatchObserver(const Ice::Current&, Ice::Int);
 
-    const IceInternal::MetricsAdminIPtr& getFacet() const;
+    IceInternal::MetricsAdminIPtr getFacet() const;
 
     void destroy();
 
 private:
 
-    IceInternal::MetricsAdminIPtr _metrics;
+    CommunicatorMetricsAdminIPtr _metrics;
     const Ice::Instrumentation::CommunicatorObserverPtr _delegate;
 
     ObserverFactoryWithDelegateT<ConnectionObserverI> _connections;
@@ -18,7 +18,19 @@ ifeq ($(DEFAULT_MUTEX_PROTOCOL), PrioInherit)
 endif
 
 Ice_sliceflags          := --include-dir Ice
+$(project)_generated_includedir := $(project)/generated/Ice
 Ice_libs                := bz2
+
+ifeq ($(ZSTD),yes)
+    Ice_cppflags        += -DICE_HAS_ZSTD
+    Ice_libs            += zstd
+endif
+
+ifeq ($(LZ4),yes)
+    Ice_cppflags        += -DICE_HAS_LZ4
+    Ice_libs            += lz4
+endif
+
 Ice_extra_sources       := $(wildcard src/IceUtil/*.cpp)
 Ice_excludes            = src/Ice/DLLMain.cpp
 
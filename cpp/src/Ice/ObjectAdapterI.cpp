@@ -1492,7 +1492,13 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "ThreadPool.SizeWarn",
         "ThreadPool.StackSize",
         "ThreadPool.Serialize",
-        "ThreadPool.ThreadPriority"
+        "ThreadPool.ThreadPriority",
+        "ThreadPool.ExecutorSize",
+        "ThreadPool.Reactors",
+        "ThreadPool.ExecutorDeadline",
+        "ThreadPool.ThreadAffinity",
+        "ThreadPool.ReactorAffinity",
+        "DispatchDeadline"
     };
 
     //
@@ -1511,6 +1517,7 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
     }
 
     bool noProps = true;
+    const string deadlinePrefix = prefix + "DispatchDeadline.";
     PropertyDict props = _instance->initializationData().properties->getPropertiesForPrefix(prefix);
     for(PropertyDict::const_iterator p = props.begin(); p != props.end(); ++p)
     {
@@ -1526,6 +1533,12 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
             }
         }
 
+        if(!valid && p->first.compare(0, deadlinePrefix.size(), deadlinePrefix) == 0) // <adapter>.DispatchDeadline.<op>
+        {
+            noProps = false;
+            valid = true;
+        }
+
         if(!valid && addUnknown)
         {
             unknownProps.push_back(p->first);
@@ -20,6 +20,8 @@
 #include <Ice/ConnectionFactory.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/LoggerUtil.h>
+#include <Ice/DirectInvocationState.h>
+#include <Ice/Segments.h>
 
 using namespace std;
 using namespace Ice;
@@ -873,6 +875,15 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
         case Reference::ModeDatagram:
         {
             _os.writeBlob(requestHdr, sizeof(requestHdr));
+            if(_synchronous && _instance->zeroCopySize() > 0 &&
+               _proxy->_getReference()->getMode() != Reference::ModeDatagram)
+            {
+                //
+                // The caller waits for synchronous invocations to be sent,
+                // large byte sequences are sent from the caller's memory.
+                //
+                startSegments(&_os);
+            }
             break;
         }
 
@@ -1094,6 +1105,9 @@ OutgoingAsync::response()
 AsyncStatus
 OutgoingAsync::invokeRemote(const ConnectionIPtr& connection, bool compress, bool response)
 {
+#ifdef ICE_CPP11_MAPPING
+    DirectInvocationState::marshal(this);
+#endif
     _cachedConnection = connection;
     return connection->sendAsyncRequest(ICE_SHARED_FROM_THIS, compress, response, 0);
 }
@@ -1101,7 +1115,11 @@ OutgoingAsync::invokeRemote(const ConnectionIPtr& connection, bool compress, boo
 AsyncStatus
 OutgoingAsync::invokeCollocated(CollocatedRequestHandler* handler)
 {
+#ifdef ICE_CPP11_MAPPING
+    return handler->invokeAsyncRequest(this, 0, _synchronous, DirectInvocationState::pending(this));
+#else
     return handler->invokeAsyncRequest(this, 0, _synchronous);
+#endif
 }
 
 void
@@ -1117,6 +1135,10 @@ OutgoingAsync::abort(const Exception& ex)
         //
         _proxy->_getBatchRequestQueue()->abortBatchRequest(&_os);
     }
+    else
+    {
+        discardSegments(&_os);
+    }
 
     ProxyOutgoingAsyncBase::abort(ex);
 }
@@ -1139,6 +1161,12 @@ OutgoingAsync::invoke(const string& operation)
     // exception.
     //
     invokeImpl(true); // userThread = true
+
+    //
+    // The request might still be retried if it wasn't handed over to a
+    // connection, copy the sequences while the caller's memory is valid.
+    //
+    flattenSegments(&_os);
 }
 
 #ifdef ICE_CPP11_MAPPING
@@ -1148,10 +1176,38 @@ OutgoingAsync::invoke(const string& operation,
                       Ice::FormatType format,
                       const Ice::Context& context,
                       function<void(Ice::OutputStream*)> write)
+{
+    invoke(operation, mode, format, context, move(write), nullptr);
+}
+
+void
+OutgoingAsync::invoke(const string& operation,
+                      Ice::OperationMode mode,
+                      Ice::FormatType format,
+                      const Ice::Context& context,
+                      function<void(Ice::OutputStream*)> write,
+                      DirectInvocation* direct)
 {
     try
     {
         prepare(operation, mode, context);
+        if(direct && _synchronous && _instance->collocationDirect() &&
+           !_instance->initializationData().observer &&
+           _proxy->_getReference()->getMode() == Reference::ModeTwoway &&
+           _proxy->_getReference()->getInvocationTimeout() <= 0)
+        {
+            //
+            // The caller waits for the response of synchronous twoway invocations
+            // without invocation timeout, a collocated servant is dispatched from
+            // this thread and can use the parameters directly. The parameters are
+            // marshaled if the request is sent, queued or retried. The state of
+            // the direct invocation is only valid until the invocation returns.
+            //
+            DirectInvocationState state(this, direct, write, _encoding, format);
+            invoke(operation);
+            return;
+        }
+
         if(write)
         {
             _os.startEncapsulation(_encoding, format);
@@ -1170,6 +1226,13 @@ OutgoingAsync::invoke(const string& operation,
     }
 }
 
+DirectInvocation*
+OutgoingAsync::getDirectResult() const
+{
+    DirectInvocationState* state = DirectInvocationState::current(this);
+    return state && state->completed ? state->invocation : 0;
+}
+
 void
 OutgoingAsync::throwUserException()
 {
@@ -21,6 +21,7 @@
 #include <Ice/LoggerUtil.h>
 #include <Ice/SlicedData.h>
 #include <Ice/StringConverter.h>
+#include <Ice/Segments.h>
 #include <iterator>
 
 using namespace std;
@@ -260,6 +261,18 @@ Ice::OutputStream::write(const Byte* begin, const Byte* end)
     writeSize(sz);
     if(sz > 0)
     {
+        //
+        // Large sequences of the parameters of synchronous invocations are
+        // sent from the caller's memory. They aren't recorded within class
+        // or exception slices, whose sizes are computed from the buffer.
+        //
+        if(_instance && _instance->zeroCopySize() > 0 && static_cast<size_t>(sz) >= _instance->zeroCopySize() &&
+           _currentEncaps && !_currentEncaps->encoder && !_currentEncaps->previous &&
+           addSegment(this, _currentEncaps->start, begin, end))
+        {
+            return;
+        }
+
         Container::size_type pos = b.size();
         resize(pos + sz);
         memcpy(&b[pos], begin, sz);
@@ -848,6 +861,11 @@ Ice::OutputStream::writeOptImpl(Int tag, OptionalFormat type)
         return false; // Optional members aren't supported with the 1.0 encoding.
     }
 
+    if(_instance && _instance->zeroCopySize() > 0)
+    {
+        closeSegments(this);
+    }
+
     Byte v = static_cast<Byte>(type);
     if(tag < 30)
     {
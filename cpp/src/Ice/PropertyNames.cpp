@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Tue May 16 17:04:55 2017
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Sat Oct 17 14:20:37 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -61,10 +61,17 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("Ice.Admin.MessageSizeMax", false, 0),
+    IceInternal::Property("Ice.Admin.DispatchDeadline", false, 0),
+    IceInternal::Property("Ice.Admin.DispatchDeadline.*", false, 0),
     IceInternal::Property("Ice.Admin.DelayCreation", false, 0),
     IceInternal::Property("Ice.Admin.Enabled", false, 0),
     IceInternal::Property("Ice.Admin.Facets", false, 0),
@@ -75,13 +82,22 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ServerId", false, 0),
     IceInternal::Property("Ice.BackgroundLocatorCacheUpdates", false, 0),
     IceInternal::Property("Ice.BatchAutoFlush", true, 0),
+    IceInternal::Property("Ice.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Ice.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Ice.BufferPool.Size", false, 0),
+    IceInternal::Property("Ice.BufferPool.ThreadCacheSize", false, 0),
     IceInternal::Property("Ice.ChangeUser", false, 0),
     IceInternal::Property("Ice.ClassGraphDepthMax", false, 0),
     IceInternal::Property("Ice.ClientAccessPolicyProtocol", false, 0),
+    IceInternal::Property("Ice.Compression.Adaptive", false, 0),
+    IceInternal::Property("Ice.Compression.AdaptiveThreshold", false, 0),
+    IceInternal::Property("Ice.Compression.Codec", false, 0),
     IceInternal::Property("Ice.Compression.Level", false, 0),
     IceInternal::Property("Ice.CollectObjects", false, 0),
+    IceInternal::Property("Ice.CollocationDirect", false, 0),
     IceInternal::Property("Ice.Config", false, 0),
+    IceInternal::Property("Ice.ConnectionPool.Selection", false, 0),
+    IceInternal::Property("Ice.ConnectionPool.Size", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
     IceInternal::Property("Ice.Default.EncodingVersion", false, 0),
@@ -143,6 +159,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.PrintProcessId", false, 0),
     IceInternal::Property("Ice.PrintStackTraces", false, 0),
     IceInternal::Property("Ice.ProgramName", false, 0),
+    IceInternal::Property("Ice.ReadAheadSize", false, 0),
     IceInternal::Property("Ice.RetryIntervals", false, 0),
     IceInternal::Property("Ice.ServerIdleTime", false, 0),
     IceInternal::Property("Ice.SOCKSProxyHost", false, 0),
@@ -154,20 +171,32 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Client.SizeMax", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.SizeWarn", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.StackSize", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactors", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.ExecutorSize", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.ExecutorDeadline", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.ThreadAffinity", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.ReactorAffinity", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.Size", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeMax", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeWarn", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.StackSize", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactors", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.ExecutorSize", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.ExecutorDeadline", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.ThreadAffinity", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.ReactorAffinity", false, 0),
     IceInternal::Property("Ice.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadAffinity", false, 0),
     IceInternal::Property("Ice.ToStringMode", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Properties", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Logger", false, 0),
+    IceInternal::Property("Ice.Trace.BufferPool", false, 0),
     IceInternal::Property("Ice.Trace.Locator", false, 0),
     IceInternal::Property("Ice.Trace.Network", false, 0),
     IceInternal::Property("Ice.Trace.Protocol", false, 0),
@@ -188,6 +217,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Warn.Endpoints", false, 0),
     IceInternal::Property("Ice.Warn.UnknownProperties", false, 0),
     IceInternal::Property("Ice.Warn.UnusedProperties", false, 0),
+    IceInternal::Property("Ice.ZeroCopySize", false, 0),
     IceInternal::Property("Ice.CacheMessageBuffers", false, 0),
     IceInternal::Property("Ice.ThreadInterruptSafe", false, 0),
     IceInternal::Property("Ice.Voip", false, 0),
@@ -246,10 +276,17 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.DispatchDeadline", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Close", false, 0),
@@ -283,10 +320,17 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceDiscovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.DispatchDeadline", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Close", false, 0),
@@ -320,10 +364,17 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceDiscovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.DispatchDeadline", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceDiscovery.Lookup", false, 0),
     IceInternal::Property("IceDiscovery.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.RetryCount", false, 0),
@@ -373,10 +424,17 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.DispatchDeadline", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Close", false, 0),
@@ -410,10 +468,17 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.DispatchDeadline", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Lookup", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Timeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.RetryCount", false, 0),
@@ -506,10 +571,17 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceBridge.Source.MessageSizeMax", false, 0),
+    IceInternal::Property("IceBridge.Source.DispatchDeadline", false, 0),
+    IceInternal::Property("IceBridge.Source.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceBridge.Target.Endpoints", false, 0),
     IceInternal::Property("IceBridge.InstanceName", false, 0),
 };
@@ -564,10 +636,17 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.DispatchDeadline", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Close", false, 0),
@@ -601,10 +680,17 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.DispatchDeadline", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.Observers", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.SaveToRegistry", false, 0),
 };
@@ -648,10 +734,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.DispatchDeadline", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceGrid.InstanceName", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Heartbeat", false, 0),
@@ -686,10 +779,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceGrid.Node.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Node.DispatchDeadline", false, 0),
+    IceInternal::Property("IceGrid.Node.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceGrid.Node.AllowRunningServersAsRoot", false, 0),
     IceInternal::Property("IceGrid.Node.AllowEndpointsOverride", false, 0),
     IceInternal::Property("IceGrid.Node.CollocateRegistry", false, 0),
@@ -764,10 +864,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.DispatchDeadline", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.PreferSecure", false, 0),
@@ -811,10 +918,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.DispatchDeadline", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceGrid.Registry.CryptPasswords", false, 0),
     IceInternal::Property("IceGrid.Registry.DefaultTemplates", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ACM.Timeout", false, 0),
@@ -850,10 +964,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.DispatchDeadline", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Enabled", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Address", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Port", false, 0),
@@ -892,10 +1013,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.DispatchDeadline", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.MapSize", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.Path", false, 0),
     IceInternal::Property("IceGrid.Registry.NodeSessionTimeout", false, 0),
@@ -946,10 +1074,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.DispatchDeadline", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionFilters", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Heartbeat", false, 0),
@@ -984,10 +1119,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.DispatchDeadline", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.DispatchDeadline.*", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionCached", false, 0),
@@ -1054,10 +1196,17 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("IcePatch2.MessageSizeMax", false, 0),
+    IceInternal::Property("IcePatch2.DispatchDeadline", false, 0),
+    IceInternal::Property("IcePatch2.DispatchDeadline.*", false, 0),
     IceInternal::Property("IcePatch2.Directory", false, 0),
     IceInternal::Property("IcePatch2.InstanceName", false, 0),
 };
@@ -1099,6 +1248,7 @@ const IceInternal::Property IceSSLPropsData[] =
     IceInternal::Property("IceSSL.FindCert", false, 0),
     IceInternal::Property("IceSSL.FindCert.*", true, 0),
     IceInternal::Property("IceSSL.InitOpenSSL", false, 0),
+    IceInternal::Property("IceSSL.KernelTLS", false, 0),
     IceInternal::Property("IceSSL.KeyFile", true, 0),
     IceInternal::Property("IceSSL.Keychain", false, 0),
     IceInternal::Property("IceSSL.KeychainPassword", false, 0),
@@ -1113,6 +1263,10 @@ const IceInternal::Property IceSSLPropsData[] =
     IceInternal::Property("IceSSL.ProtocolVersionMin", false, 0),
     IceInternal::Property("IceSSL.Random", false, 0),
     IceInternal::Property("IceSSL.SchannelStrongCrypto", false, 0),
+    IceInternal::Property("IceSSL.SessionCache", false, 0),
+    IceInternal::Property("IceSSL.SessionCacheSize", false, 0),
+    IceInternal::Property("IceSSL.SessionTicketKeys", false, 0),
+    IceInternal::Property("IceSSL.SessionTimeout", false, 0),
     IceInternal::Property("IceSSL.Trace.Security", false, 0),
     IceInternal::Property("IceSSL.TrustOnly", false, 0),
     IceInternal::Property("IceSSL.TrustOnly.Client", false, 0),
@@ -1187,10 +1341,17 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("Glacier2.Client.MessageSizeMax", false, 0),
+    IceInternal::Property("Glacier2.Client.DispatchDeadline", false, 0),
+    IceInternal::Property("Glacier2.Client.DispatchDeadline.*", false, 0),
     IceInternal::Property("Glacier2.Client.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Client.Buffered", false, 0),
     IceInternal::Property("Glacier2.Client.ForwardContext", false, 0),
@@ -1262,10 +1423,17 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.StackSize", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.ExecutorSize", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.ExecutorDeadline", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.ThreadAffinity", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.ReactorAffinity", false, 0),
     IceInternal::Property("Glacier2.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("Glacier2.Server.DispatchDeadline", false, 0),
+    IceInternal::Property("Glacier2.Server.DispatchDeadline.*", false, 0),
     IceInternal::Property("Glacier2.Server.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Server.Buffered", false, 0),
     IceInternal::Property("Glacier2.Server.ForwardContext", false, 0),
@@ -0,0 +1,252 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_REQUEST_TABLE_H
+#define ICE_REQUEST_TABLE_H
+
+#include <Ice/Config.h>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// Table of the pending requests of a connection or collocated request handler,
+// keyed by request ID.
+//
+// The entries are stored in a single open-addressed array of slots. Request IDs
+// are allocated sequentially, so the low-order bits of the ID are used directly
+// as the slot index and collisions (resolved with linear probing) only occur
+// once the IDs wrap around. Entries are removed with backward shifting, which
+// avoids tombstones. Unlike std::map, inserting or removing a request doesn't
+// allocate memory once the table has grown to the number of requests in flight.
+//
+// Request ID 0 is reserved for oneway requests and is used to mark free slots,
+// it can't be inserted in the table. Inserting or erasing an entry invalidates
+// iterators.
+//
+template<typename T>
+class RequestTable
+{
+public:
+
+    struct Entry
+    {
+        Entry() : first(0)
+        {
+        }
+
+        Ice::Int first;
+        T second;
+    };
+
+    class iterator
+    {
+    public:
+
+        iterator() : _p(0), _end(0)
+        {
+        }
+
+        Entry& operator*() const
+        {
+            return *_p;
+        }
+
+        Entry* operator->() const
+        {
+            return _p;
+        }
+
+        iterator& operator++()
+        {
+            ++_p;
+            skip();
+            return *this;
+        }
+
+        bool operator==(const iterator& rhs) const
+        {
+            return _p == rhs._p;
+        }
+
+        bool operator!=(const iterator& rhs) const
+        {
+            return _p != rhs._p;
+        }
+
+    private:
+
+        friend class RequestTable;
+
+        iterator(Entry* p, Entry* end) : _p(p), _end(end)
+        {
+            skip();
+        }
+
+        void skip()
+        {
+            while(_p != _end && _p->first == 0)
+            {
+                ++_p;
+            }
+        }
+
+        Entry* _p;
+        Entry* _end;
+    };
+
+    RequestTable() : _size(0)
+    {
+    }
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    iterator begin()
+    {
+        return _slots.empty() ? iterator() : iterator(&_slots[0], &_slots[0] + _slots.size());
+    }
+
+    iterator end()
+    {
+        return _slots.empty() ? iterator() : iterator(&_slots[0] + _slots.size(), &_slots[0] + _slots.size());
+    }
+
+    iterator find(Ice::Int id)
+    {
+        if(_size == 0)
+        {
+            return end();
+        }
+
+        const size_t mask = _slots.size() - 1;
+        for(size_t i = static_cast<size_t>(id) & mask; _slots[i].first != 0; i = (i + 1) & mask)
+        {
+            if(_slots[i].first == id)
+            {
+                return iterator(&_slots[i], &_slots[0] + _slots.size());
+            }
+        }
+        return end();
+    }
+
+    //
+    // The ID must not already be present in the table.
+    //
+    void insert(Ice::Int id, const T& value)
+    {
+        assert(id > 0);
+        if((_size + 1) * 4 > _slots.size() * 3)
+        {
+            grow();
+        }
+
+        const size_t mask = _slots.size() - 1;
+        size_t i = static_cast<size_t>(id) & mask;
+        while(_slots[i].first != 0)
+        {
+            assert(_slots[i].first != id);
+            i = (i + 1) & mask;
+        }
+        _slots[i].first = id;
+        _slots[i].second = value;
+        ++_size;
+    }
+
+    void erase(iterator p)
+    {
+        assert(p._p && p._p->first != 0);
+
+        const size_t mask = _slots.size() - 1;
+        size_t i = static_cast<size_t>(p._p - &_slots[0]);
+        size_t j = i;
+        while(true)
+        {
+            j = (j + 1) & mask;
+            if(_slots[j].first == 0)
+            {
+                break;
+            }
+
+            //
+            // Move the entry at j back into the free slot i unless its home
+            // slot lies cyclically in (i, j], in which case moving it would
+            // make it unreachable.
+            //
+            const size_t k = static_cast<size_t>(_slots[j].first) & mask;
+            if(i <= j ? (i < k && k <= j) : (i < k || k <= j))
+            {
+                continue;
+            }
+            _slots[i] = _slots[j];
+            i = j;
+        }
+        _slots[i].first = 0;
+        _slots[i].second = T();
+        --_size;
+    }
+
+    bool erase(Ice::Int id)
+    {
+        iterator p = find(id);
+        if(p == end())
+        {
+            return false;
+        }
+        erase(p);
+        return true;
+    }
+
+    //
+    // Clears the table but keeps the slots allocated.
+    //
+    void clear()
+    {
+        if(_size > 0)
+        {
+            for(typename std::vector<Entry>::iterator p = _slots.begin(); p != _slots.end(); ++p)
+            {
+                p->first = 0;
+                p->second = T();
+            }
+            _size = 0;
+        }
+    }
+
+private:
+
+    void grow()
+    {
+        std::vector<Entry> slots(_slots.empty() ? 16 : _slots.size() * 2);
+        slots.swap(_slots);
+        _size = 0;
+        for(typename std::vector<Entry>::const_iterator p = slots.begin(); p != slots.end(); ++p)
+        {
+            if(p->first != 0)
+            {
+                insert(p->first, p->second);
+            }
+        }
+    }
+
+    std::vector<Entry> _slots;
+    size_t _size;
+};
+
+}
+
+#endif
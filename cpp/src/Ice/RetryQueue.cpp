@@ -13,6 +13,8 @@
 #include <Ice/Instance.h>
 #include <Ice/TraceLevels.h>
 #include <Ice/LoggerUtil.h>
+#include <Ice/DirectInvocationState.h>
+#include <Ice/Segments.h>
 
 using namespace std;
 using namespace Ice;
@@ -91,6 +93,10 @@ IceInternal::RetryQueue::add(const ProxyOutgoingAsyncBasePtr& out, int interval)
     {
         throw CommunicatorDestroyedException(__FILE__, __LINE__);
     }
+#ifdef ICE_CPP11_MAPPING
+    DirectInvocationState::marshal(out.get()); // The request is retried once the invocation returned.
+#endif
+    flattenSegments(out->getOs()); // The request is retried from the timer thread.
     RetryTaskPtr task = ICE_MAKE_SHARED(RetryTask, _instance, this, out);
     out->cancelable(task); // This will throw if the request is canceled.
     try
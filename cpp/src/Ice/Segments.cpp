@@ -0,0 +1,282 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Segments.h>
+
+#if defined(_WIN32)
+#   include <windows.h>
+#else
+#   include <pthread.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// The requests whose sequences are recorded by a thread, the last one
+// first. A thread can make an invocation, for example to a router,
+// between the marshaling and the sending of a request.
+//
+struct Recording
+{
+    OutputStream* stream;
+    OutputStream::size_type encapsStart;
+    bool closed;
+    SegmentList segments;
+    Recording* previous;
+};
+
+#if !defined(ICE_OS_UWP)
+bool hasKey = false;
+#   if defined(_WIN32)
+DWORD key;
+#   else
+pthread_key_t key;
+#   endif
+#endif
+
+class Init
+{
+public:
+
+    Init()
+    {
+#if defined(_WIN32) && !defined(ICE_OS_UWP)
+        key = TlsAlloc();
+        hasKey = key != TLS_OUT_OF_INDEXES;
+#elif !defined(_WIN32)
+        hasKey = pthread_key_create(&key, 0) == 0;
+#endif
+    }
+
+    ~Init()
+    {
+#if !defined(ICE_OS_UWP)
+        if(hasKey)
+        {
+            hasKey = false;
+#   if defined(_WIN32)
+            TlsFree(key);
+#   else
+            pthread_key_delete(key);
+#   endif
+        }
+#endif
+    }
+};
+
+Init init;
+
+Recording*
+getRecordings()
+{
+#if defined(ICE_OS_UWP)
+    return 0;
+#elif defined(_WIN32)
+    return hasKey ? static_cast<Recording*>(TlsGetValue(key)) : 0;
+#else
+    return hasKey ? static_cast<Recording*>(pthread_getspecific(key)) : 0;
+#endif
+}
+
+bool
+setRecordings(Recording* recordings)
+{
+#if defined(ICE_OS_UWP)
+    return false;
+#elif defined(_WIN32)
+    return hasKey && TlsSetValue(key, recordings);
+#else
+    return hasKey && pthread_setspecific(key, recordings) == 0;
+#endif
+}
+
+Recording*
+find(const OutputStream* stream)
+{
+    for(Recording* p = getRecordings(); p; p = p->previous)
+    {
+        if(p->stream == stream)
+        {
+            return p;
+        }
+    }
+    return 0;
+}
+
+void
+remove(Recording* recording)
+{
+    Recording* p = getRecordings();
+    if(p == recording)
+    {
+        setRecordings(recording->previous);
+    }
+    else
+    {
+        while(p->previous != recording)
+        {
+            p = p->previous;
+        }
+        p->previous = recording->previous;
+    }
+    delete recording;
+}
+
+void
+fixEncapsulationSize(Recording* recording)
+{
+    //
+    // The encapsulation of the parameters ends the request, its size
+    // computed by endEncapsulation doesn't include the sequences.
+    //
+    OutputStream* stream = recording->stream;
+    stream->rewrite(static_cast<Int>(stream->b.size() - recording->encapsStart + recording->segments.size()),
+                    recording->encapsStart);
+}
+
+}
+
+void
+IceInternal::SegmentList::add(OutputStream::size_type pos, const Byte* begin, const Byte* end)
+{
+    Segment segment = { pos, begin, end };
+    _segments.push_back(segment);
+    _size += static_cast<size_t>(end - begin);
+}
+
+void
+IceInternal::SegmentList::swap(SegmentList& other)
+{
+    _segments.swap(other._segments);
+    std::swap(_size, other._size);
+}
+
+void
+IceInternal::SegmentList::clear()
+{
+    _segments.clear();
+    _size = 0;
+}
+
+void
+IceInternal::SegmentList::flatten(OutputStream& stream)
+{
+    if(_segments.empty())
+    {
+        return;
+    }
+
+    //
+    // Insert the sequences in the buffer, starting with the last one so
+    // that the data following a sequence is moved only once. The position
+    // of the iterator, if set, is kept relative to the start of the buffer.
+    //
+    OutputStream::size_type size = stream.b.size();
+    OutputStream::size_type pos = stream.i ? static_cast<OutputStream::size_type>(stream.i - stream.b.begin()) : 0;
+    bool hasPos = stream.i != 0;
+    stream.resize(size + _size);
+    OutputStream::size_type end = size + _size;
+    for(vector<Segment>::const_reverse_iterator p = _segments.rbegin(); p != _segments.rend(); ++p)
+    {
+        OutputStream::size_type length = static_cast<OutputStream::size_type>(p->end - p->begin);
+        OutputStream::size_type tail = size - p->pos;
+        memmove(&stream.b[0] + end - tail, &stream.b[0] + p->pos, tail);
+        end -= tail + length;
+        memcpy(&stream.b[0] + end, p->begin, length);
+        size = p->pos;
+    }
+    stream.i = hasPos ? stream.b.begin() + pos : 0;
+    clear();
+}
+
+void
+IceInternal::startSegments(OutputStream* stream)
+{
+    Recording* recording = new Recording;
+    recording->stream = stream;
+    recording->encapsStart = 0;
+    recording->closed = false;
+    recording->previous = getRecordings();
+    if(!setRecordings(recording))
+    {
+        delete recording;
+    }
+}
+
+bool
+IceInternal::addSegment(OutputStream* stream, OutputStream::size_type encapsStart, const Byte* begin, const Byte* end)
+{
+    Recording* recording = find(stream);
+    if(!recording || recording->closed)
+    {
+        return false;
+    }
+    assert(recording->segments.empty() || recording->encapsStart == encapsStart);
+    recording->encapsStart = encapsStart;
+    recording->segments.add(stream->b.size(), begin, end);
+    return true;
+}
+
+void
+IceInternal::closeSegments(const OutputStream* stream)
+{
+    Recording* recording = find(stream);
+    if(recording)
+    {
+        recording->closed = true;
+    }
+}
+
+bool
+IceInternal::takeSegments(OutputStream* stream, SegmentList& segments)
+{
+    Recording* recording = find(stream);
+    if(!recording)
+    {
+        return false;
+    }
+    bool taken = !recording->segments.empty();
+    if(taken)
+    {
+        fixEncapsulationSize(recording);
+        segments.swap(recording->segments);
+    }
+    remove(recording);
+    return taken;
+}
+
+void
+IceInternal::flattenSegments(OutputStream* stream)
+{
+    Recording* recording = find(stream);
+    if(recording)
+    {
+        if(!recording->segments.empty())
+        {
+            fixEncapsulationSize(recording);
+            recording->segments.flatten(*stream);
+        }
+        remove(recording);
+    }
+}
+
+void
+IceInternal::discardSegments(const OutputStream* stream)
+{
+    Recording* recording = find(stream);
+    if(recording)
+    {
+        remove(recording);
+    }
+}
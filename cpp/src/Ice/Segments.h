@@ -0,0 +1,117 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_SEGMENTS_H
+#define ICE_SEGMENTS_H
+
+#include <Ice/OutputStream.h>
+
+namespace IceInternal
+{
+
+//
+// A byte sequence of a request which isn't copied in the request stream,
+// see Ice.ZeroCopySize. The sequence belongs at the given position of the
+// stream buffer.
+//
+struct Segment
+{
+    Ice::OutputStream::size_type pos;
+    const Ice::Byte* begin;
+    const Ice::Byte* end;
+};
+
+class SegmentList
+{
+public:
+
+    SegmentList() : _size(0)
+    {
+    }
+
+    bool empty() const
+    {
+        return _segments.empty();
+    }
+
+    //
+    // The number of bytes of the sequences, the size of the request is
+    // the size of the stream buffer plus this size.
+    //
+    size_t size() const
+    {
+        return _size;
+    }
+
+    const std::vector<Segment>& segments() const
+    {
+        return _segments;
+    }
+
+    void add(Ice::OutputStream::size_type, const Ice::Byte*, const Ice::Byte*);
+    void swap(SegmentList&);
+    void clear();
+
+    //
+    // Copy the sequences in the stream buffer at their position and clear
+    // the list.
+    //
+    void flatten(Ice::OutputStream&);
+
+private:
+
+    std::vector<Segment> _segments;
+    size_t _size;
+};
+
+//
+// The sequences of a request are recorded by the thread which marshals
+// it, from OutgoingAsync::prepare until the request is given to a
+// connection, which keeps them until the request is sent or answered.
+// The stream must be flattened before it's queued or retried by another
+// thread. The caller of the synchronous invocation waits until then,
+// its memory stays valid.
+//
+void startSegments(Ice::OutputStream*);
+
+//
+// Called by OutputStream::write with the position of the encapsulation of
+// the parameters, returns true if the sequence is recorded rather than
+// copied in the stream. The size of the encapsulation is fixed up when
+// the sequences are taken or flattened.
+//
+bool addSegment(Ice::OutputStream*, Ice::OutputStream::size_type, const Ice::Byte*, const Ice::Byte*);
+
+//
+// The sizes of optional parameters are computed from the stream buffer,
+// no sequences are recorded once an optional parameter is written.
+//
+void closeSegments(const Ice::OutputStream*);
+
+//
+// Move the sequences recorded by this thread for the stream to the given
+// list, returns false if there are none. The recording ends.
+//
+bool takeSegments(Ice::OutputStream*, SegmentList&);
+
+//
+// Copy the sequences recorded by this thread in the stream. The recording
+// ends.
+//
+void flattenSegments(Ice::OutputStream*);
+
+//
+// End the recording without copying the sequences, the request isn't
+// sent.
+//
+void discardSegments(const Ice::OutputStream*);
+
+}
+
+#endif
@@ -12,6 +12,7 @@
 #include <Ice/LocalException.h>
 #include <Ice/LoggerUtil.h>
 #include <Ice/Instance.h>
+#include <Ice/Properties.h>
 #include <Ice/StringUtil.h>
 
 using namespace std;
@@ -27,20 +28,18 @@ IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity&
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    const unsigned int h = identityHash(ident);
+    ServantShard& s = shard(h);
+    IceUtil::Mutex::Lock shardSync(s.mutex);
 
-    if(p == _servantMapMap.end() || p->first != ident)
+    ServantMapMap::iterator p = findEntry(s.servants, h, ident);
+    if(p == s.servants.end())
     {
-        p = _servantMapMap.find(ident);
-    }
-
-    if(p == _servantMapMap.end())
-    {
-        p = _servantMapMap.insert(_servantMapMapHint, pair<const Identity, FacetMap>(ident, FacetMap()));
+        p = s.servants.insert(make_pair(h, make_pair(ident, FacetMap())));
     }
     else
     {
-        if(p->second.find(facet) != p->second.end())
+        if(p->second.second.find(facet) != p->second.second.end())
         {
             ToStringMode toStringMode = _instance->toStringMode();
             ostringstream os;
@@ -53,9 +52,7 @@ IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity&
         }
     }
 
-    _servantMapMapHint = p;
-
-    p->second.insert(pair<const string, ObjectPtr>(facet, object));
+    p->second.second.insert(pair<const string, ObjectPtr>(facet, object));
 }
 
 void
@@ -88,15 +85,14 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
+    const unsigned int h = identityHash(ident);
+    ServantShard& s = shard(h);
+    IceUtil::Mutex::Lock shardSync(s.mutex);
 
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    ServantMapMap::iterator p = findEntry(s.servants, h, ident);
+    FacetMap::iterator q;
 
-    if(p == _servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    if(p == s.servants.end() || (q = p->second.second.find(facet)) == p->second.second.end())
     {
         ToStringMode toStringMode = _instance->toStringMode();
         ostringstream os;
@@ -109,19 +105,11 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
     }
 
     servant = q->second;
-    p->second.erase(q);
+    p->second.second.erase(q);
 
-    if(p->second.empty())
+    if(p->second.second.empty())
     {
-        if(p == _servantMapMapHint)
-        {
-            _servantMapMap.erase(p++);
-            _servantMapMapHint = p;
-        }
-        else
-        {
-            _servantMapMap.erase(p);
-        }
+        s.servants.erase(p);
     }
     return servant;
 }
@@ -159,37 +147,45 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    const unsigned int h = identityHash(ident);
+    ServantShard& s = shard(h);
+    IceUtil::Mutex::Lock shardSync(s.mutex);
 
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
-
-    if(p == _servantMapMap.end())
+    ServantMapMap::iterator p = findEntry(s.servants, h, ident);
+    if(p == s.servants.end())
     {
         throw NotRegisteredException(__FILE__, __LINE__, "servant",
                                      Ice::identityToString(ident, _instance->toStringMode()));
     }
 
-    FacetMap result = p->second;
-
-    if(p == _servantMapMapHint)
-    {
-        _servantMapMap.erase(p++);
-        _servantMapMapHint = p;
-    }
-    else
-    {
-        _servantMapMap.erase(p);
-    }
-
+    FacetMap result = p->second.second;
+    s.servants.erase(p);
     return result;
 }
 
 ObjectPtr
 IceInternal::ServantManager::findServant(const Identity& ident, const string& facet) const
 {
+    //
+    // This is called for every dispatch, registered servants are looked
+    // up with only the mutex of their shard locked.
+    //
+    {
+        const unsigned int h = identityHash(ident);
+        ServantShard& s = shard(h);
+        IceUtil::Mutex::Lock shardSync(s.mutex);
+
+        ServantMapMap::iterator p = findEntry(s.servants, h, ident);
+        if(p != s.servants.end())
+        {
+            FacetMap::const_iterator q = p->second.second.find(facet);
+            if(q != p->second.second.end())
+            {
+                return q->second;
+            }
+        }
+    }
+
     IceUtil::Mutex::Lock sync(*this);
 
     //
@@ -200,30 +196,13 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string& fa
     //
     //assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
-
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
-
-    if(p == servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    DefaultServantMap::const_iterator p = _defaultServantMap.find(ident.category);
+    if(p == _defaultServantMap.end())
     {
-        DefaultServantMap::const_iterator p = _defaultServantMap.find(ident.category);
+        p = _defaultServantMap.find("");
         if(p == _defaultServantMap.end())
         {
-            p = _defaultServantMap.find("");
-            if(p == _defaultServantMap.end())
-            {
-                return 0;
-            }
-            else
-            {
-                return p->second;
-            }
+            return 0;
         }
         else
         {
@@ -232,8 +211,7 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string& fa
     }
     else
     {
-        _servantMapMapHint = p;
-        return q->second;
+        return p->second;
     }
 }
 
@@ -260,55 +238,41 @@ IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
+    const unsigned int h = identityHash(ident);
+    ServantShard& s = shard(h);
+    IceUtil::Mutex::Lock shardSync(s.mutex);
 
-    if(p == servantMapMap.end())
+    ServantMapMap::iterator p = findEntry(s.servants, h, ident);
+    if(p == s.servants.end())
     {
         return FacetMap();
     }
     else
     {
-        _servantMapMapHint = p;
-        return p->second;
+        return p->second.second;
     }
 }
 
 bool
 IceInternal::ServantManager::hasServant(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-
     //
-    // This assert is not valid if the adapter dispatch incoming
-    // requests from bidir connections. This method might be called if
-    // requests are received over the bidir connection after the
-    // adapter was deactivated.
+    // This method might be called if requests are received over a bidir
+    // connection after the adapter was deactivated, the shards are empty
+    // once the servant manager is destroyed.
     //
-    //assert(_instance); // Must not be called after destruction.
+    const unsigned int h = identityHash(ident);
+    ServantShard& s = shard(h);
+    IceUtil::Mutex::Lock shardSync(s.mutex);
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
-
-    if(p == servantMapMap.end())
+    ServantMapMap::iterator p = findEntry(s.servants, h, ident);
+    if(p == s.servants.end())
     {
         return false;
     }
     else
     {
-        _servantMapMapHint = p;
-        assert(!p->second.empty());
+        assert(!p->second.second.empty());
         return true;
     }
 }
@@ -402,12 +366,42 @@ IceInternal::ServantManager::findServantLocator(const string& category) const
     }
 }
 
+int
+IceInternal::ServantManager::dispatchDeadline(const string& operation) const
+{
+    //
+    // No locking needed, the deadlines are immutable after construction.
+    //
+    if(!_operationDispatchDeadlines.empty())
+    {
+        map<string, int>::const_iterator p = _operationDispatchDeadlines.find(operation);
+        if(p != _operationDispatchDeadlines.end())
+        {
+            return p->second;
+        }
+    }
+    return _dispatchDeadline;
+}
+
 IceInternal::ServantManager::ServantManager(const InstancePtr& instance, const string& adapterName)
     : _instance(instance),
       _adapterName(adapterName),
-      _servantMapMapHint(_servantMapMap.end()),
-      _locatorMapHint(_locatorMap.end())
+      _locatorMapHint(_locatorMap.end()),
+      _dispatchDeadline(-1)
 {
+    if(!_adapterName.empty())
+    {
+        PropertiesPtr properties = _instance->initializationData().properties;
+        _dispatchDeadline = properties->getPropertyAsIntWithDefault(_adapterName + ".DispatchDeadline", -1);
+
+        const string prefix = _adapterName + ".DispatchDeadline.";
+        PropertyDict props = properties->getPropertiesForPrefix(prefix);
+        for(PropertyDict::const_iterator p = props.begin(); p != props.end(); ++p)
+        {
+            _operationDispatchDeadlines[p->first.substr(prefix.size())] =
+                properties->getPropertyAsIntWithDefault(p->first, -1);
+        }
+    }
 }
 
 IceInternal::ServantManager::~ServantManager()
@@ -420,10 +414,49 @@ IceInternal::ServantManager::~ServantManager()
     //assert(!_instance);
 }
 
+unsigned int
+IceInternal::ServantManager::identityHash(const Identity& ident)
+{
+    //
+    // FNV-1a over the name and category.
+    //
+    unsigned int h = 2166136261U;
+    for(string::const_iterator p = ident.name.begin(); p != ident.name.end(); ++p)
+    {
+        h = (h ^ static_cast<unsigned char>(*p)) * 16777619U;
+    }
+    h = (h ^ '/') * 16777619U;
+    for(string::const_iterator p = ident.category.begin(); p != ident.category.end(); ++p)
+    {
+        h = (h ^ static_cast<unsigned char>(*p)) * 16777619U;
+    }
+    return h;
+}
+
+IceInternal::ServantManager::ServantShard&
+IceInternal::ServantManager::shard(unsigned int h) const
+{
+    return _servantShards[h % ServantShardCount];
+}
+
+IceInternal::ServantManager::ServantMapMap::iterator
+IceInternal::ServantManager::findEntry(ServantMapMap& servants, unsigned int h, const Identity& ident)
+{
+    pair<ServantMapMap::iterator, ServantMapMap::iterator> r = servants.equal_range(h);
+    for(ServantMapMap::iterator p = r.first; p != r.second; ++p)
+    {
+        if(p->second.first == ident)
+        {
+            return p;
+        }
+    }
+    return servants.end();
+}
+
 void
 IceInternal::ServantManager::destroy()
 {
-    ServantMapMap servantMapMap;
+    ServantMapMap servantMapMaps[ServantShardCount];
     DefaultServantMap defaultServantMap;
     map<string, ServantLocatorPtr> locatorMap;
     Ice::LoggerPtr logger;
@@ -440,8 +473,11 @@ IceInternal::ServantManager::destroy()
 
         logger = _instance->initializationData().logger;
 
-        servantMapMap.swap(_servantMapMap);
-        _servantMapMapHint = _servantMapMap.end();
+        for(int i = 0; i < ServantShardCount; ++i)
+        {
+            IceUtil::Mutex::Lock shardSync(_servantShards[i].mutex);
+            servantMapMaps[i].swap(_servantShards[i].servants);
+        }
 
         defaultServantMap.swap(_defaultServantMap);
 
@@ -479,7 +515,10 @@ IceInternal::ServantManager::destroy()
     // hold any internal Ice mutex while running user code (such as servant
     // or servant locator destructors).
     //
-    servantMapMap.clear();
+    for(int i = 0; i < ServantShardCount; ++i)
+    {
+        servantMapMaps[i].clear();
+    }
     locatorMap.clear();
     defaultServantMap.clear();
 }
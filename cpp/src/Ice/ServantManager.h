@@ -46,6 +46,8 @@ public:
     Ice::ServantLocatorPtr removeServantLocator(const std::string&);
     Ice::ServantLocatorPtr findServantLocator(const std::string&) const;
 
+    int dispatchDeadline(const std::string&) const;
+
 private:
 
     ServantManager(const InstancePtr&, const std::string&);
@@ -57,16 +59,41 @@ private:
 
     const std::string _adapterName;
 
-    typedef std::map<Ice::Identity, Ice::FacetMap> ServantMapMap;
+    //
+    // The servants are spread over shards according to the hash of their
+    // identity. Each shard has its own mutex, so threads dispatching to
+    // different servants rarely contend, and the servants of a shard are
+    // ordered by hash, so a lookup compares integers rather than identities
+    // until it reaches the servant.
+    //
+    typedef std::multimap<unsigned int, std::pair<Ice::Identity, Ice::FacetMap> > ServantMapMap;
     typedef std::map<std::string, Ice::ObjectPtr> DefaultServantMap;
 
-    ServantMapMap _servantMapMap;
-    mutable ServantMapMap::iterator _servantMapMapHint;
+    struct ServantShard
+    {
+        IceUtil::Mutex mutex;
+        ServantMapMap servants;
+    };
+
+    enum { ServantShardCount = 32 };
+
+    static unsigned int identityHash(const Ice::Identity&);
+    ServantShard& shard(unsigned int) const;
+    static ServantMapMap::iterator findEntry(ServantMapMap&, unsigned int, const Ice::Identity&);
+
+    mutable ServantShard _servantShards[ServantShardCount];
 
     DefaultServantMap _defaultServantMap;
 
     std::map<std::string, Ice::ServantLocatorPtr> _locatorMap;
     mutable std::map<std::string, Ice::ServantLocatorPtr>::iterator _locatorMapHint;
+
+    //
+    // The dispatch deadlines configured for the adapter and its operations,
+    // in milliseconds, immutable after construction.
+    //
+    int _dispatchDeadline;
+    std::map<std::string, int> _operationDispatchDeadlines;
 };
 
 }
@@ -11,6 +11,10 @@
 #include <Ice/NetworkProxy.h>
 #include <Ice/ProtocolInstance.h>
 
+#if !defined(_WIN32)
+#   include <sys/uio.h>
+#endif
+
 using namespace IceInternal;
 
 #if defined(ICE_OS_UWP)
@@ -356,6 +360,94 @@ StreamSocket::write(const char* buf, size_t length)
 }
 #endif
 
+#if !defined(_WIN32)
+SocketOperation
+StreamSocket::write(const std::vector<Buffer*>& buffers)
+{
+    assert(_fd != INVALID_SOCKET);
+    assert(_state == StateConnected);
+
+    std::vector<Buffer*>::const_iterator p = buffers.begin();
+    while(true)
+    {
+        //
+        // Skip the buffers which are fully written.
+        //
+        while(p != buffers.end() && (*p)->i == (*p)->b.end())
+        {
+            ++p;
+        }
+        if(p == buffers.end())
+        {
+            return SocketOperationNone;
+        }
+
+        struct iovec iov[64];
+        int count = 0;
+        for(std::vector<Buffer*>::const_iterator q = p; q != buffers.end() && count < 64; ++q)
+        {
+            if((*q)->i != (*q)->b.end())
+            {
+                iov[count].iov_base = (*q)->i;
+                iov[count].iov_len = static_cast<size_t>((*q)->b.end() - (*q)->i);
+                ++count;
+            }
+        }
+
+        ssize_t ret = ::writev(_fd, iov, count);
+        if(ret == 0)
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, 0);
+        }
+        else if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+
+            if(noBuffers())
+            {
+                //
+                // Fallback to writing the first buffer with send, it
+                // reduces the packet size until the system accepts it.
+                //
+                if(write(**p))
+                {
+                    return SocketOperationWrite;
+                }
+                continue;
+            }
+
+            if(wouldBlock())
+            {
+                return SocketOperationWrite;
+            }
+
+            if(connectionLost())
+            {
+                throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+
+        //
+        // Advance the buffers by the number of bytes written.
+        //
+        size_t sent = static_cast<size_t>(ret);
+        for(std::vector<Buffer*>::const_iterator q = p; sent > 0; ++q)
+        {
+            size_t length = std::min(sent, static_cast<size_t>((*q)->b.end() - (*q)->i));
+            (*q)->i += length;
+            sent -= length;
+        }
+    }
+}
+#endif
+
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
 AsyncInfo*
 StreamSocket::getAsyncInfo(SocketOperation op)
@@ -41,6 +41,10 @@ public:
     ssize_t write(const char*, size_t);
 #endif
 
+#if !defined(_WIN32)
+    SocketOperation write(const std::vector<Buffer*>&);
+#endif
+
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     AsyncInfo* getAsyncInfo(SocketOperation);
 #endif
@@ -50,6 +50,26 @@ IceInternal::TcpTransceiver::write(Buffer& buf)
     return _stream->write(buf);
 }
 
+#if !defined(_WIN32)
+bool
+IceInternal::TcpTransceiver::supportsWritev() const
+{
+    return true;
+}
+
+SocketOperation
+IceInternal::TcpTransceiver::writev(const vector<Buffer*>& buffers)
+{
+    return _stream->write(buffers);
+}
+
+bool
+IceInternal::TcpTransceiver::supportsReadAhead() const
+{
+    return true;
+}
+#endif
+
 SocketOperation
 IceInternal::TcpTransceiver::read(Buffer& buf)
 {
@@ -38,6 +38,11 @@ public:
     virtual void finishWrite(Buffer&);
     virtual void startRead(Buffer&);
     virtual void finishRead(Buffer&);
+#endif
+#if !defined(_WIN32)
+    virtual bool supportsWritev() const;
+    virtual SocketOperation writev(const std::vector<Buffer*>&);
+    virtual bool supportsReadAhead() const;
 #endif
     virtual std::string protocol() const;
     virtual std::string toString() const;
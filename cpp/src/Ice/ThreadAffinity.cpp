@@ -0,0 +1,208 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/ThreadAffinity.h>
+#include <IceUtil/StringUtil.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <cassert>
+#include <cstdlib>
+#include <errno.h>
+
+#if defined(__linux__)
+#   include <pthread.h>
+#   include <sched.h>
+#endif
+
+using namespace std;
+
+namespace
+{
+
+bool
+parseNumber(const string& s, int& n)
+{
+    if(s.empty() || s.find_first_not_of("0123456789") != string::npos || s.size() > 6)
+    {
+        return false;
+    }
+    n = atoi(s.c_str());
+    return true;
+}
+
+bool
+parseCpuList(const string& value, vector<int>& cpus)
+{
+    vector<string> tokens;
+    IceUtilInternal::splitString(value, ",", tokens);
+    if(tokens.empty())
+    {
+        return false;
+    }
+
+    for(vector<string>::const_iterator p = tokens.begin(); p != tokens.end(); ++p)
+    {
+        string token = IceUtilInternal::trim(*p);
+        if(token.compare(0, 5, "node:") == 0)
+        {
+#if defined(__linux__)
+            int node;
+            if(!parseNumber(token.substr(5), node))
+            {
+                return false;
+            }
+            ostringstream path;
+            path << "/sys/devices/system/node/node" << node << "/cpulist";
+            ifstream is(path.str().c_str());
+            string list;
+            if(!getline(is, list) || !parseCpuList(IceUtilInternal::trim(list), cpus))
+            {
+                return false;
+            }
+            continue;
+#else
+            return false;
+#endif
+        }
+
+        int first;
+        int last;
+        string::size_type pos = token.find('-');
+        if(pos == string::npos)
+        {
+            if(!parseNumber(token, first))
+            {
+                return false;
+            }
+            last = first;
+        }
+        else if(!parseNumber(IceUtilInternal::trim(token.substr(0, pos)), first) ||
+                !parseNumber(IceUtilInternal::trim(token.substr(pos + 1)), last) || last < first)
+        {
+            return false;
+        }
+
+        for(int i = first; i <= last; ++i)
+        {
+            cpus.push_back(i);
+        }
+    }
+    return true;
+}
+
+}
+
+bool
+IceInternal::parseThreadAffinity(const string& value, vector<int>& cpus)
+{
+    vector<int> result;
+    if(!parseCpuList(value, result))
+    {
+        return false;
+    }
+    sort(result.begin(), result.end());
+    result.erase(unique(result.begin(), result.end()), result.end());
+    cpus.swap(result);
+    return true;
+}
+
+vector<int>
+IceInternal::splitThreadAffinity(const vector<int>& cpus, int count, int index)
+{
+    assert(count > 0 && index >= 0 && index < count);
+    if(cpus.empty() || count == 1)
+    {
+        return cpus;
+    }
+
+    const size_t n = cpus.size();
+    if(n < static_cast<size_t>(count))
+    {
+        return vector<int>(1, cpus[static_cast<size_t>(index) % n]);
+    }
+    return vector<int>(cpus.begin() + static_cast<ptrdiff_t>(n * static_cast<size_t>(index) / count),
+                       cpus.begin() + static_cast<ptrdiff_t>(n * static_cast<size_t>(index + 1) / count));
+}
+
+bool
+IceInternal::setThreadAffinity(const vector<int>& cpus, string& error)
+{
+    assert(!cpus.empty());
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for(vector<int>::const_iterator p = cpus.begin(); p != cpus.end(); ++p)
+    {
+        if(*p >= CPU_SETSIZE)
+        {
+            ostringstream os;
+            os << "CPU " << *p << " is out of range, the largest CPU number is " << CPU_SETSIZE - 1;
+            error = os.str();
+            return false;
+        }
+        CPU_SET(*p, &set);
+    }
+    int rs = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if(rs != 0)
+    {
+        error = IceUtilInternal::errorToString(rs);
+        return false;
+    }
+    return true;
+#elif defined(_WIN32) && !defined(ICE_OS_UWP)
+    DWORD_PTR mask = 0;
+    for(vector<int>::const_iterator p = cpus.begin(); p != cpus.end(); ++p)
+    {
+        if(*p >= static_cast<int>(sizeof(DWORD_PTR) * 8))
+        {
+            ostringstream os;
+            os << "CPU " << *p << " is out of range, the largest CPU number is " << sizeof(DWORD_PTR) * 8 - 1;
+            error = os.str();
+            return false;
+        }
+        mask |= static_cast<DWORD_PTR>(1) << *p;
+    }
+    if(SetThreadAffinityMask(GetCurrentThread(), mask) == 0)
+    {
+        error = IceUtilInternal::lastErrorToString();
+        return false;
+    }
+    return true;
+#else
+    error = "thread affinity isn't supported on this platform";
+    return false;
+#endif
+}
+
+string
+IceInternal::threadAffinityToString(const vector<int>& cpus)
+{
+    ostringstream os;
+    for(vector<int>::const_iterator p = cpus.begin(); p != cpus.end();)
+    {
+        vector<int>::const_iterator q = p;
+        while(q + 1 != cpus.end() && *(q + 1) == *q + 1)
+        {
+            ++q;
+        }
+        if(p != cpus.begin())
+        {
+            os << ',';
+        }
+        os << *p;
+        if(q != p)
+        {
+            os << '-' << *q;
+        }
+        p = q + 1;
+    }
+    return os.str();
+}
@@ -0,0 +1,45 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_THREAD_AFFINITY_H
+#define ICE_THREAD_AFFINITY_H
+
+#include <Ice/Config.h>
+
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// Parses the set of CPUs of a ThreadAffinity property, a comma separated
+// list of CPU numbers and ranges such as "0-3,8". On Linux, "node:<n>"
+// denotes the CPUs of the given NUMA node. Returns false if the value is
+// invalid, the CPUs are returned sorted and without duplicates.
+//
+bool parseThreadAffinity(const std::string&, std::vector<int>&);
+
+//
+// Returns the given part of a set of CPUs split into the given number of
+// parts of the same size. If the set has fewer CPUs than parts, each part
+// is a single CPU.
+//
+std::vector<int> splitThreadAffinity(const std::vector<int>&, int, int);
+
+//
+// Binds the calling thread to the given CPUs. Returns false and sets the
+// error message if the binding failed or isn't supported on this platform.
+//
+bool setThreadAffinity(const std::vector<int>&, std::string&);
+
+std::string threadAffinityToString(const std::vector<int>&);
+
+}
+
+#endif
@@ -17,6 +17,7 @@
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/Properties.h>
 #include <Ice/TraceLevels.h>
+#include <Ice/ThreadAffinity.h>
 
 #if defined(ICE_OS_UWP)
 #   include <Ice/StringConverter.h>
@@ -115,6 +116,78 @@ class ThreadPoolDestroyedException
 {
 };
 
+void
+threadStart(const InstancePtr& instance, const string& prefix)
+{
+#ifdef ICE_CPP11_MAPPING
+    if(instance->initializationData().threadStart)
+#else
+    if(instance->initializationData().threadHook)
+#endif
+    {
+        try
+        {
+#ifdef ICE_CPP11_MAPPING
+            instance->initializationData().threadStart();
+#else
+            instance->initializationData().threadHook->start();
+#endif
+        }
+        catch(const exception& ex)
+        {
+            Error out(instance->initializationData().logger);
+            out << "thread hook start() method raised an unexpected exception in `" << prefix << "':\n" << ex;
+        }
+        catch(...)
+        {
+            Error out(instance->initializationData().logger);
+            out << "thread hook start() method raised an unexpected exception in `" << prefix << "'";
+        }
+    }
+}
+
+void
+bindThread(const InstancePtr& instance, const string& prefix, const vector<int>& cpus)
+{
+    string error;
+    if(!cpus.empty() && !setThreadAffinity(cpus, error))
+    {
+        Warning out(instance->initializationData().logger);
+        out << "cannot bind thread of `" << prefix << "' to CPUs " << threadAffinityToString(cpus) << ":\n"
+            << error;
+    }
+}
+
+void
+threadStop(const InstancePtr& instance, const string& prefix)
+{
+#ifdef ICE_CPP11_MAPPING
+    if(instance->initializationData().threadStop)
+#else
+    if(instance->initializationData().threadHook)
+#endif
+    {
+        try
+        {
+#ifdef ICE_CPP11_MAPPING
+            instance->initializationData().threadStop();
+#else
+            instance->initializationData().threadHook->stop();
+#endif
+        }
+        catch(const exception& ex)
+        {
+            Error out(instance->initializationData().logger);
+            out << "thread hook stop() method raised an unexpected exception in `" << prefix << "':\n" << ex;
+        }
+        catch(...)
+        {
+            Error out(instance->initializationData().logger);
+            out << "thread hook stop() method raised an unexpected exception in `" << prefix << "'";
+        }
+    }
+}
+
 }
 
 Ice::DispatcherCall::~DispatcherCall()
@@ -248,7 +321,8 @@ IceInternal::ThreadPoolWorkQueue::getNativeInfo()
     return 0;
 }
 
-IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& prefix, int timeout) :
+IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& prefix, int timeout, int reactor,
+                                    const vector<int>& affinity) :
     _instance(instance),
     _dispatcher(_instance->initializationData().dispatcher),
     _destroyed(false),
@@ -265,6 +339,10 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
     _serverIdleTime(timeout),
     _threadIdleTime(0),
     _stackSize(0),
+    _reactor(reactor),
+    _affinity(affinity),
+    _nextReactor(0),
+    _executorDeadline(0),
     _inUse(0),
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
     _inUseIO(0),
@@ -342,6 +420,72 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
 #endif
     const_cast<int&>(_threadIdleTime) = threadIdleTime;
 
+    //
+    // Additional reactors are only created by the thread pool itself,
+    // they are not supported with the server idle time since each
+    // reactor only monitors the activity of its own handlers.
+    //
+    int reactors = 1;
+    if(_reactor == 0)
+    {
+        reactors = properties->getPropertyAsIntWithDefault(_prefix + ".Reactors", 1);
+        if(reactors < 1)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << _prefix << ".Reactors < 1; Reactors adjusted to 1";
+            reactors = 1;
+        }
+        else if(reactors > 1 && _serverIdleTime > 0)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << _prefix << ".Reactors > 1 is not supported with Ice.ServerIdleTime; Reactors adjusted to 1";
+            reactors = 1;
+        }
+    }
+
+    //
+    // The executor is created by the thread pool itself and shared with its
+    // additional reactors. It replaces the dispatch from the thread pool
+    // threads, it's therefore not used if a dispatcher is configured.
+    //
+    int executorSize = 0;
+    if(_reactor == 0)
+    {
+        executorSize = properties->getPropertyAsInt(_prefix + ".ExecutorSize");
+        if(executorSize < 0)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << _prefix << ".ExecutorSize < 0; ExecutorSize adjusted to 0";
+            executorSize = 0;
+        }
+        else if(executorSize > 0 && _dispatcher)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << _prefix << ".ExecutorSize > 0 is not supported with a dispatcher; ExecutorSize adjusted to 0";
+            executorSize = 0;
+        }
+#if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
+        else if(executorSize > 0 && _serialize)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << _prefix << ".ExecutorSize > 0 is not supported with " << _prefix
+                << ".Serialize on this platform; ExecutorSize adjusted to 0";
+            executorSize = 0;
+        }
+#endif
+
+        if(executorSize > 0)
+        {
+            _executorDeadline = properties->getPropertyAsInt(_prefix + ".ExecutorDeadline");
+            if(_executorDeadline < 0)
+            {
+                Warning out(_instance->initializationData().logger);
+                out << _prefix << ".ExecutorDeadline < 0; ExecutorDeadline adjusted to 0";
+                _executorDeadline = 0;
+            }
+        }
+    }
+
 #ifdef ICE_USE_IOCP
     _selector.setup(_sizeIO);
 #endif
@@ -372,14 +516,93 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
         const_cast<int&>(_priority) = properties->getPropertyAsInt("Ice.ThreadPriority");
     }
 
+    //
+    // The threads are bound to the CPUs of <prefix>.ThreadAffinity or of
+    // Ice.ThreadAffinity. With ReactorAffinity, each reactor is bound to its
+    // share of these CPUs (all the CPUs if not set), along with the executor
+    // threads dispatching its messages. The additional reactors get their
+    // share from the thread pool.
+    //
+    vector<int> cpus;
+    vector<vector<int> > executorAffinities;
+    bool reactorAffinity = false;
+    if(_reactor == 0)
+    {
+        string name = _prefix + ".ThreadAffinity";
+        string value = properties->getProperty(name);
+        if(value.empty())
+        {
+            name = "Ice.ThreadAffinity";
+            value = properties->getProperty(name);
+        }
+        if(!value.empty() && !parseThreadAffinity(value, cpus))
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "invalid value for " << name << ": `" << value << "'; threads aren't bound to CPUs";
+        }
+
+        reactorAffinity = properties->getPropertyAsInt(_prefix + ".ReactorAffinity") > 0 && reactors > 1;
+#ifndef ICE_OS_UWP
+        if(reactorAffinity && cpus.empty())
+        {
+            for(int i = 0; i < nProcessors; ++i)
+            {
+                cpus.push_back(i);
+            }
+        }
+#endif
+        if(reactorAffinity)
+        {
+            const_cast<vector<int>&>(_affinity) = splitThreadAffinity(cpus, reactors, 0);
+            if(executorSize >= reactors)
+            {
+                for(int i = 0; i < reactors; ++i)
+                {
+                    executorAffinities.push_back(splitThreadAffinity(cpus, reactors, i));
+                }
+            }
+            else if(executorSize > 0)
+            {
+                Warning out(_instance->initializationData().logger);
+                out << _prefix << ".ExecutorSize < " << _prefix << ".Reactors; executor threads aren't bound to "
+                    << "the reactors";
+            }
+        }
+        else
+        {
+            const_cast<vector<int>&>(_affinity) = cpus;
+        }
+
+        if(executorAffinities.empty())
+        {
+            executorAffinities.push_back(cpus);
+        }
+    }
+
     _workQueue = ICE_MAKE_SHARED(ThreadPoolWorkQueue, *this);
     _selector.initialize(_workQueue.get());
 
-    if(_instance->traceLevels()->threadPool >= 1)
+    if(_reactor == 0 && _instance->traceLevels()->threadPool >= 1)
     {
         Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
         out << "creating " << _prefix << ": Size = " << _size << ", SizeMax = " << _sizeMax << ", SizeWarn = "
             << _sizeWarn;
+        if(reactors > 1)
+        {
+            out << ", Reactors = " << reactors;
+        }
+        if(executorSize > 0)
+        {
+            out << ", ExecutorSize = " << executorSize;
+        }
+        if(_executorDeadline > 0)
+        {
+            out << ", ExecutorDeadline = " << _executorDeadline;
+        }
+        if(!cpus.empty())
+        {
+            out << ", ThreadAffinity = " << threadAffinityToString(cpus);
+        }
     }
 
     __setNoDelete(true);
@@ -398,6 +621,26 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
             }
             _threads.insert(thread);
         }
+
+        if(executorSize > 0)
+        {
+            _executor = new DispatchExecutor(_instance, _prefix, executorSize, _executorDeadline > 0,
+                                             executorAffinities);
+            _executor->start(_stackSize, _hasPriority, _priority);
+        }
+
+        for(int i = 1; i < reactors; ++i)
+        {
+            _reactors.push_back(new ThreadPool(_instance, _prefix, _serverIdleTime, i,
+                                               reactorAffinity ? splitThreadAffinity(cpus, reactors, i) : cpus));
+
+            //
+            // No connection is assigned to the reactor before the thread pool
+            // is constructed, the reactor threads can't use the executor yet.
+            //
+            _reactors.back()->_executor = _executor;
+            _reactors.back()->_executorDeadline = _executorDeadline;
+        }
     }
     catch(const IceUtil::Exception& ex)
     {
@@ -434,6 +677,16 @@ IceInternal::ThreadPool::destroy()
     }
     _destroyed = true;
     _workQueue->destroy();
+
+    for(vector<ThreadPoolPtr>::const_iterator p = _reactors.begin(); p != _reactors.end(); ++p)
+    {
+        (*p)->destroy();
+    }
+
+    if(_executor && _reactor == 0)
+    {
+        _executor->destroy();
+    }
 }
 
 void
@@ -444,6 +697,11 @@ IceInternal::ThreadPool::updateObservers()
     {
         (*p)->updateObserver();
     }
+
+    for(vector<ThreadPoolPtr>::const_iterator p = _reactors.begin(); p != _reactors.end(); ++p)
+    {
+        (*p)->updateObservers();
+    }
 }
 
 void
@@ -571,6 +829,62 @@ IceInternal::ThreadPool::dispatchFromThisThread(const DispatchWorkItemPtr& workI
     }
 }
 
+void
+IceInternal::ThreadPool::dispatchFromThisThread(const DispatchWorkItemPtr& workItem,
+                                                ThreadPoolCurrent& current,
+                                                const IceUtil::Time& deadline)
+{
+    //
+    // Only the messages of the event handlers are handed over to the
+    // executor, the work items of the work queue are still dispatched by
+    // the thread pool threads.
+    //
+    if(!_executor || current._handler.get() == _workQueue.get())
+    {
+        dispatchFromThisThread(workItem);
+        return;
+    }
+
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    if(_serialize)
+    {
+        //
+        // The handler stays disabled until the executor has dispatched the
+        // message, so the next message of the connection isn't read before.
+        // With more than one thread, ioCompleted() already disabled it.
+        //
+        if(_sizeMax == 1)
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+            if(!_destroyed)
+            {
+                _selector.disable(current._handler.get(), current.operation);
+            }
+        }
+        current._enableDeferred = true;
+        _executor->execute(workItem, deadline, _reactor, this, current._handler, current.operation);
+        return;
+    }
+#endif
+
+    _executor->execute(workItem, deadline, _reactor, 0, 0, SocketOperationNone);
+}
+
+void
+IceInternal::ThreadPool::dispatched(const EventHandlerPtr& handler, SocketOperation operation)
+{
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    if(!_destroyed)
+    {
+        _selector.enable(handler.get(), operation);
+    }
+#else
+    (void)handler;
+    (void)operation;
+#endif
+}
+
 void
 IceInternal::ThreadPool::dispatch(const DispatchWorkItemPtr& workItem)
 {
@@ -597,7 +911,16 @@ IceInternal::ThreadPool::joinWithAllThreads()
     {
         (*p)->getThreadControl().join();
     }
+    if(_executor && _reactor == 0)
+    {
+        _executor->joinWithAllThreads();
+    }
     _selector.destroy();
+
+    for(vector<ThreadPoolPtr>::const_iterator p = _reactors.begin(); p != _reactors.end(); ++p)
+    {
+        (*p)->joinWithAllThreads();
+    }
 }
 
 string
@@ -606,6 +929,20 @@ IceInternal::ThreadPool::prefix() const
     return _prefix;
 }
 
+ThreadPoolPtr
+IceInternal::ThreadPool::nextReactor()
+{
+    if(_reactors.empty())
+    {
+        return this;
+    }
+
+    Lock sync(*this);
+    size_t reactor = _nextReactor;
+    _nextReactor = (_nextReactor + 1) % (_reactors.size() + 1);
+    return reactor == 0 ? ThreadPoolPtr(this) : _reactors[reactor - 1];
+}
+
 void
 IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
 {
@@ -684,7 +1021,7 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
                     // If the handler called ioCompleted(), we re-enable the handler in
                     // case it was disabled and we decrease the number of thread in use.
                     //
-                    if(_serialize && current._handler.get() != _workQueue.get())
+                    if(_serialize && current._handler.get() != _workQueue.get() && !current._enableDeferred)
                     {
                         _selector.enable(current._handler.get(), current.operation);
                     }
@@ -709,6 +1046,7 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
             if(_nextHandler != _handlers.end())
             {
                 current._ioCompleted = false;
+                current._enableDeferred = false;
                 current._handler = ICE_GET_SHARED_FROM_THIS(_nextHandler->first);
                 current.operation = _nextHandler->second;
                 ++_nextHandler;
@@ -1137,7 +1475,12 @@ string
 IceInternal::ThreadPool::nextThreadId()
 {
     ostringstream os;
-    os << _prefix << "-" << _nextThreadId++;
+    os << _prefix << "-";
+    if(_reactor > 0)
+    {
+        os << _reactor << "-";
+    }
+    os << _nextThreadId++;
     return os.str();
 }
 
@@ -1177,31 +1520,8 @@ IceInternal::ThreadPool::EventHandlerThread::setState(Ice::Instrumentation::Thre
 void
 IceInternal::ThreadPool::EventHandlerThread::run()
 {
-#ifdef ICE_CPP11_MAPPING
-    if(_pool->_instance->initializationData().threadStart)
-#else
-    if(_pool->_instance->initializationData().threadHook)
-#endif
-    {
-        try
-        {
-#ifdef ICE_CPP11_MAPPING
-            _pool->_instance->initializationData().threadStart();
-#else
-            _pool->_instance->initializationData().threadHook->start();
-#endif
-        }
-        catch(const exception& ex)
-        {
-            Error out(_pool->_instance->initializationData().logger);
-            out << "thread hook start() method raised an unexpected exception in `" << _pool->_prefix << "':\n" << ex;
-        }
-        catch(...)
-        {
-            Error out(_pool->_instance->initializationData().logger);
-            out << "thread hook start() method raised an unexpected exception in `" << _pool->_prefix << "'";
-        }
-    }
+    threadStart(_pool->_instance, _pool->_prefix);
+    bindThread(_pool->_instance, _pool->_prefix, _pool->_affinity);
 
     try
     {
@@ -1220,31 +1540,7 @@ IceInternal::ThreadPool::EventHandlerThread::run()
 
     _observer.detach();
 
-#ifdef ICE_CPP11_MAPPING
-    if(_pool->_instance->initializationData().threadStop)
-#else
-    if(_pool->_instance->initializationData().threadHook)
-#endif
-    {
-        try
-        {
-#ifdef ICE_CPP11_MAPPING
-            _pool->_instance->initializationData().threadStop();
-#else
-            _pool->_instance->initializationData().threadHook->stop();
-#endif
-        }
-        catch(const exception& ex)
-        {
-            Error out(_pool->_instance->initializationData().logger);
-            out << "thread hook stop() method raised an unexpected exception in `" << _pool->_prefix << "':\n" << ex;
-        }
-        catch(...)
-        {
-            Error out(_pool->_instance->initializationData().logger);
-            out << "thread hook stop() method raised an unexpected exception in `" << _pool->_prefix << "'";
-        }
-    }
+    threadStop(_pool->_instance, _pool->_prefix);
 
     _pool = 0; // Break cyclic dependency.
 }
@@ -1256,9 +1552,267 @@ ThreadPoolCurrent::ThreadPoolCurrent(const InstancePtr& instance,
     stream(instance.get(), Ice::currentProtocolEncoding),
     _threadPool(threadPool.get()),
     _thread(thread),
-    _ioCompleted(false)
+    _ioCompleted(false),
+    _enableDeferred(false)
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
     , _leader(false)
 #endif
 {
 }
+
+IceInternal::DispatchExecutor::DispatchExecutor(const InstancePtr& instance, const string& prefix, int size,
+                                                bool ordered, const vector<vector<int> >& affinities) :
+    _instance(instance),
+    _prefix(prefix),
+    _ordered(ordered),
+    _affinities(affinities),
+    _groups(affinities.size()),
+    _next(0),
+    _idle(0),
+    _destroyed(false)
+{
+    assert(size > 0 && _groups > 0 && _groups <= static_cast<size_t>(size));
+    for(int i = 0; i < size; ++i)
+    {
+        _queues.push_back(new Queue());
+    }
+}
+
+void
+IceInternal::DispatchExecutor::start(size_t stackSize, bool hasPriority, int priority)
+{
+    for(size_t i = 0; i < _queues.size(); ++i)
+    {
+        ostringstream name;
+        name << _prefix << "-executor-" << i;
+        WorkerThreadPtr thread = new WorkerThread(this, i, name.str());
+        if(hasPriority)
+        {
+            thread->start(stackSize, priority);
+        }
+        else
+        {
+            thread->start(stackSize);
+        }
+        _threads.push_back(thread);
+    }
+}
+
+void
+IceInternal::DispatchExecutor::execute(const DispatchWorkItemPtr& workItem,
+                                       const IceUtil::Time& deadline,
+                                       int reactor,
+                                       const ThreadPoolPtr& threadPool,
+                                       const EventHandlerPtr& handler,
+                                       SocketOperation operation)
+{
+    Message msg;
+    msg.workItem = workItem;
+    msg.threadPool = threadPool;
+    msg.handler = handler;
+    msg.operation = operation;
+    msg.deadline = deadline;
+
+    //
+    // The workers of a group are the workers whose index modulo the number
+    // of groups is the group index.
+    //
+    const size_t group = static_cast<size_t>(reactor) % _groups;
+    if(_ordered)
+    {
+        //
+        // Insert the message after the messages with an earlier or the same
+        // deadline, the other workers of the group steal it from the queue
+        // of its first worker.
+        //
+        Queue& queue = *_queues[group];
+        IceUtil::Mutex::Lock sync(queue);
+        deque<Message>::iterator p = queue.messages.end();
+        while(p != queue.messages.begin() && deadline < (p - 1)->deadline)
+        {
+            --p;
+        }
+        queue.messages.insert(p, msg);
+    }
+    else
+    {
+        //
+        // Queue the message round-robin, an idle worker steals it if its own
+        // queue is empty.
+        //
+        size_t next = static_cast<unsigned int>(_next.fetch_add(1)) % groupSize(group);
+        const QueuePtr& queue = _queues[group + next * _groups];
+        IceUtil::Mutex::Lock sync(*queue);
+        queue->messages.push_back(msg);
+    }
+
+    if(_idle.load() > 0)
+    {
+        Lock sync(*this);
+        if(_groups > 1)
+        {
+            notifyAll(); // The waiting worker might not be in the group.
+        }
+        else
+        {
+            notify();
+        }
+    }
+}
+
+void
+IceInternal::DispatchExecutor::destroy()
+{
+    Lock sync(*this);
+    _destroyed = true;
+    notifyAll();
+}
+
+void
+IceInternal::DispatchExecutor::joinWithAllThreads()
+{
+    //
+    // _threads is immutable after start(), the workers return once the
+    // executor is destroyed and all the queued messages are dispatched.
+    //
+    for(vector<WorkerThreadPtr>::const_iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+}
+
+void
+IceInternal::DispatchExecutor::run(size_t index)
+{
+    while(true)
+    {
+        Message msg;
+        if(pop(index, msg))
+        {
+            try
+            {
+                msg.workItem->run();
+            }
+            catch(const exception& ex)
+            {
+                Error out(_instance->initializationData().logger);
+                out << "exception in `" << _prefix << "':\n" << ex;
+            }
+            catch(...)
+            {
+                Error out(_instance->initializationData().logger);
+                out << "unknown exception in `" << _prefix << "'";
+            }
+
+            if(msg.threadPool)
+            {
+                msg.threadPool->dispatched(msg.handler, msg.operation);
+            }
+            continue;
+        }
+
+        Lock sync(*this);
+
+        //
+        // The idle count is incremented with the mutex locked before
+        // checking the queues again, execute() can't miss this worker.
+        //
+        _idle.fetch_add(1);
+        while(!_destroyed && empty(index))
+        {
+            wait();
+        }
+        _idle.fetch_add(-1);
+
+        if(_destroyed && empty(index))
+        {
+            return;
+        }
+    }
+}
+
+bool
+IceInternal::DispatchExecutor::pop(size_t index, Message& msg)
+{
+    {
+        Queue& queue = *_queues[index];
+        IceUtil::Mutex::Lock sync(queue);
+        if(!queue.messages.empty())
+        {
+            msg = queue.messages.front();
+            queue.messages.pop_front();
+            return true;
+        }
+    }
+
+    //
+    // Steal the most recently queued message of another worker of the
+    // group, it's the least likely to be dispatched soon by its owner. If
+    // the messages are ordered, take the most urgent message instead.
+    //
+    const size_t group = index % _groups;
+    const size_t size = groupSize(group);
+    for(size_t i = 1; i < size; ++i)
+    {
+        Queue& queue = *_queues[group + ((index / _groups + i) % size) * _groups];
+        IceUtil::Mutex::Lock sync(queue);
+        if(!queue.messages.empty())
+        {
+            if(_ordered)
+            {
+                msg = queue.messages.front();
+                queue.messages.pop_front();
+            }
+            else
+            {
+                msg = queue.messages.back();
+                queue.messages.pop_back();
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+IceInternal::DispatchExecutor::empty(size_t index) const
+{
+    for(size_t i = index % _groups; i < _queues.size(); i += _groups)
+    {
+        IceUtil::Mutex::Lock sync(*_queues[i]);
+        if(!_queues[i]->messages.empty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t
+IceInternal::DispatchExecutor::groupSize(size_t group) const
+{
+    return (_queues.size() - group + _groups - 1) / _groups;
+}
+
+IceInternal::DispatchExecutor::WorkerThread::WorkerThread(const DispatchExecutorPtr& executor,
+                                                          size_t index,
+                                                          const string& name) :
+    IceUtil::Thread(name),
+    _executor(executor),
+    _index(index)
+{
+}
+
+void
+IceInternal::DispatchExecutor::WorkerThread::run()
+{
+    threadStart(_executor->_instance, _executor->_prefix);
+    bindThread(_executor->_instance, _executor->_prefix,
+               _executor->_affinities[_index % _executor->_groups]);
+
+    _executor->run(_index);
+
+    threadStop(_executor->_instance, _executor->_prefix);
+
+    _executor = 0; // Break cyclic dependency.
+}
@@ -14,6 +14,7 @@
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
 #include <IceUtil/Thread.h>
+#include <IceUtil/Atomic.h>
 
 #include <Ice/Config.h>
 #include <Ice/Dispatcher.h>
@@ -28,6 +29,7 @@
 
 #include <set>
 #include <list>
+#include <deque>
 
 namespace IceInternal
 {
@@ -37,6 +39,9 @@ class ThreadPoolCurrent;
 class ThreadPoolWorkQueue;
 ICE_DEFINE_PTR(ThreadPoolWorkQueuePtr, ThreadPoolWorkQueue);
 
+class DispatchExecutor;
+typedef IceUtil::Handle<DispatchExecutor> DispatchExecutorPtr;
+
 class ThreadPoolWorkItem : public virtual IceUtil::Shared
 {
 public:
@@ -88,7 +93,7 @@ class ThreadPool : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mut
 
 public:
 
-    ThreadPool(const InstancePtr&, const std::string&, int);
+    ThreadPool(const InstancePtr&, const std::string&, int, int = 0, const std::vector<int>& = std::vector<int>());
     virtual ~ThreadPool();
 
     void destroy();
@@ -109,16 +114,37 @@ public:
     void ready(const EventHandlerPtr&, SocketOperation, bool);
 
     void dispatchFromThisThread(const DispatchWorkItemPtr&);
+    void dispatchFromThisThread(const DispatchWorkItemPtr&, ThreadPoolCurrent&, const IceUtil::Time&);
     void dispatch(const DispatchWorkItemPtr&);
 
+    bool hasExecutor() const
+    {
+        return _executor;
+    }
+
+    int executorDeadline() const
+    {
+        return _executorDeadline;
+    }
+
     void joinWithAllThreads();
 
     std::string prefix() const;
 
+    //
+    // Returns the thread pool reactor to use for a new event handler. If
+    // <prefix>.Reactors is greater than 1, the pool is composed of several
+    // reactors, each with its own selector, threads and work queue, and
+    // handlers are assigned to them in a round-robin fashion.
+    //
+    ThreadPoolPtr nextReactor();
+
 private:
 
     void run(const EventHandlerThreadPtr&);
 
+    void dispatched(const EventHandlerPtr&, SocketOperation);
+
     bool ioCompleted(ThreadPoolCurrent&);
 
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
@@ -146,6 +172,7 @@ private:
     friend class EventHandlerThread;
     friend class ThreadPoolCurrent;
     friend class ThreadPoolWorkQueue;
+    friend class DispatchExecutor;
 
     const int _size; // Number of threads that are pre-created.
     const int _sizeIO; // Maximum number of threads that can concurrently perform IO.
@@ -157,6 +184,14 @@ private:
     const int _serverIdleTime;
     const int _threadIdleTime;
     const size_t _stackSize;
+    const int _reactor; // The index of this reactor, 0 for the thread pool itself.
+    const std::vector<int> _affinity; // The CPUs the threads of this reactor are bound to, empty if not bound.
+
+    std::vector<ThreadPoolPtr> _reactors; // The additional reactors, immutable after construction.
+    size_t _nextReactor;
+
+    DispatchExecutorPtr _executor; // Shared by the reactors, immutable after construction.
+    int _executorDeadline; // The default dispatch budget in ms, 0 if the executor doesn't order messages.
 
     std::set<EventHandlerThreadPtr> _threads; // All threads, running or not.
     int _inUse; // Number of threads that are currently in use.
@@ -200,9 +235,14 @@ public:
     }
 #endif
 
-    void dispatchFromThisThread(const DispatchWorkItemPtr& workItem)
+    //
+    // The deadline orders the messages queued for the executor, if the
+    // executor orders messages. A null deadline dispatches the message
+    // before the requests queued with a deadline.
+    //
+    void dispatchFromThisThread(const DispatchWorkItemPtr& workItem, const IceUtil::Time& deadline = IceUtil::Time())
     {
-        _threadPool->dispatchFromThisThread(workItem);
+        _threadPool->dispatchFromThisThread(workItem, *this, deadline);
     }
 
 private:
@@ -211,6 +251,7 @@ private:
     ThreadPool::EventHandlerThreadPtr _thread;
     EventHandlerPtr _handler;
     bool _ioCompleted;
+    bool _enableDeferred; // True if the executor re-enables the handler once the message is dispatched.
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
     bool _leader;
 #else
@@ -246,6 +287,87 @@ private:
     std::list<ThreadPoolWorkItemPtr> _workItems;
 };
 
+//
+// The executor of a thread pool, see <threadpool>.ExecutorSize. The threads
+// of the pool only read the messages of their connections and hand them over
+// to the executor threads, which dispatch them. Each executor thread has its
+// own queue: messages are queued in a round-robin fashion, a thread takes the
+// oldest message of its queue and, when its queue is empty, steals the most
+// recent message from the queue of another thread.
+//
+// With <threadpool>.ExecutorDeadline, the messages are instead kept in a
+// single queue ordered by deadline (the arrival time plus the dispatch budget
+// of the request, see ConnectionI::message) and the executor threads always
+// dispatch the message with the earliest deadline. Since the deadline of a
+// queued message doesn't change, bulk requests aren't starved by a steady
+// flow of requests with a shorter budget.
+//
+// With <threadpool>.ReactorAffinity, the executor threads are split in one
+// group per reactor, bound to the CPUs of the reactor. The messages read by
+// a reactor are only dispatched, and stolen, by the threads of its group.
+//
+class DispatchExecutor : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mutex>
+{
+    class WorkerThread : public IceUtil::Thread
+    {
+    public:
+
+        WorkerThread(const DispatchExecutorPtr&, size_t, const std::string&);
+        virtual void run();
+
+    private:
+
+        DispatchExecutorPtr _executor;
+        const size_t _index;
+    };
+    typedef IceUtil::Handle<WorkerThread> WorkerThreadPtr;
+
+    struct Message
+    {
+        DispatchWorkItemPtr workItem;
+        ThreadPoolPtr threadPool; // Set if the handler must be re-enabled once the message is dispatched.
+        EventHandlerPtr handler;
+        SocketOperation operation;
+        IceUtil::Time deadline;
+    };
+
+    class Queue : public IceUtil::Shared, public IceUtil::Mutex
+    {
+    public:
+
+        std::deque<Message> messages;
+    };
+    typedef IceUtil::Handle<Queue> QueuePtr;
+
+public:
+
+    DispatchExecutor(const InstancePtr&, const std::string&, int, bool, const std::vector<std::vector<int> >&);
+
+    void start(size_t, bool, int);
+    void execute(const DispatchWorkItemPtr&, const IceUtil::Time&, int, const ThreadPoolPtr&,
+                 const EventHandlerPtr&, SocketOperation);
+    void destroy();
+    void joinWithAllThreads();
+
+private:
+
+    void run(size_t);
+    bool pop(size_t, Message&);
+    bool empty(size_t) const;
+    size_t groupSize(size_t) const;
+
+    const InstancePtr _instance;
+    const std::string _prefix;
+    const bool _ordered;
+    const std::vector<std::vector<int> > _affinities; // The CPUs of each group of threads.
+    const size_t _groups;
+    std::vector<QueuePtr> _queues; // Immutable after construction.
+    std::vector<WorkerThreadPtr> _threads; // Immutable after start().
+    IceUtilInternal::Atomic _next;
+    IceUtilInternal::Atomic _idle;
+    bool _destroyed;
+};
+
 //
 // The ThreadPoolMessage class below hides the IOCP implementation details from
 // the event handler implementations. Only event handler implementation that
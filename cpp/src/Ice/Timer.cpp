@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <IceUtil/Timer.h>
+#include <Ice/TimerWheel.h>
 #include <IceUtil/Exception.h>
 #include <Ice/ConsoleUtil.h>
 
@@ -22,7 +23,8 @@ TimerTask::~TimerTask()
 
 Timer::Timer() :
     Thread("IceUtil timer thread"),
-    _destroyed(false)
+    _destroyed(false),
+    _wheel(new TimerWheel(IceUtil::Time::now(IceUtil::Time::Monotonic)))
 {
     __setNoDelete(true);
     start();
@@ -31,13 +33,19 @@ Timer::Timer() :
 
 Timer::Timer(int priority) :
     Thread("IceUtil timer thread"),
-    _destroyed(false)
+    _destroyed(false),
+    _wheel(new TimerWheel(IceUtil::Time::now(IceUtil::Time::Monotonic)))
 {
     __setNoDelete(true);
     start(0, priority);
     __setNoDelete(false);
 }
 
+Timer::~Timer()
+{
+    delete _wheel;
+}
+
 void
 Timer::destroy()
 {
@@ -49,8 +57,7 @@ Timer::destroy()
         }
         _destroyed = true;
         _monitor.notify();
-        _tasks.clear();
-        _tokens.clear();
+        _wheel->clear();
     }
 
     if(getThreadControl() == ThreadControl())
@@ -79,12 +86,11 @@ Timer::schedule(const TimerTaskPtr& task, const IceUtil::Time& delay)
         throw IllegalArgumentException(__FILE__, __LINE__, "invalid delay");
     }
 
-    bool inserted = _tasks.insert(make_pair(task, time)).second;
-    if(!inserted)
+    if(_wheel->contains(task))
     {
         throw IllegalArgumentException(__FILE__, __LINE__, "task is already scheduled");
     }
-    _tokens.insert(Token(time, IceUtil::Time(), task));
+    _wheel->add(task, IceUtil::Time(), time, now);
 
     if(_wakeUpTime == IceUtil::Time() || time < _wakeUpTime)
     {
@@ -102,20 +108,19 @@ Timer::scheduleRepeated(const TimerTaskPtr& task, const IceUtil::Time& delay)
     }
 
     IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
-    const Token token(now + delay, delay, task);
-    if(delay > IceUtil::Time() && token.scheduledTime < now)
+    IceUtil::Time time = now + delay;
+    if(delay > IceUtil::Time() && time < now)
     {
         throw IllegalArgumentException(__FILE__, __LINE__, "invalid delay");
     }
 
-    bool inserted = _tasks.insert(make_pair(task, token.scheduledTime)).second;
-    if(!inserted)
+    if(_wheel->contains(task))
     {
         throw IllegalArgumentException(__FILE__, __LINE__, "task is already scheduled");
     }
-    _tokens.insert(token);
+    _wheel->add(task, delay, time, now);
 
-    if(_wakeUpTime == IceUtil::Time() || token.scheduledTime < _wakeUpTime)
+    if(_wakeUpTime == IceUtil::Time() || time < _wakeUpTime)
     {
         _monitor.notify();
     }
@@ -130,80 +135,53 @@ Timer::cancel(const TimerTaskPtr& task)
         return false;
     }
 
-    map<TimerTaskPtr, IceUtil::Time, TimerTaskCompare>::iterator p = _tasks.find(task);
-    if(p == _tasks.end())
-    {
-        return false;
-    }
-
-    _tokens.erase(Token(p->second, IceUtil::Time(), p->first));
-    _tasks.erase(p);
-
-    return true;
+    return _wheel->remove(task);
 }
 
 void
 Timer::run()
 {
-    Token token(IceUtil::Time(), IceUtil::Time(), 0);
+    TimerTaskPtr task;
+    bool repeated = false;
     while(true)
     {
         {
             IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
 
-            if(!_destroyed)
+            if(!_destroyed && repeated)
             {
                 //
                 // If the task we just ran is a repeated task, schedule it
                 // again for executation if it wasn't canceled.
                 //
-                if(token.delay != IceUtil::Time())
-                {
-                    map<TimerTaskPtr, IceUtil::Time, TimerTaskCompare>::iterator p = _tasks.find(token.task);
-                    if(p != _tasks.end())
-                    {
-                        token.scheduledTime = IceUtil::Time::now(IceUtil::Time::Monotonic) + token.delay;
-                        p->second = token.scheduledTime;
-                        _tokens.insert(token);
-                    }
-                }
-                token = Token(IceUtil::Time(), IceUtil::Time(), 0);
-
-                if(_tokens.empty())
-                {
-                    _wakeUpTime = IceUtil::Time();
-                    _monitor.wait();
-                }
+                _wheel->reschedule(task, IceUtil::Time::now(IceUtil::Time::Monotonic));
             }
+            task = ICE_NULLPTR;
+            repeated = false;
 
-            if(_destroyed)
-            {
-                break;
-            }
-
-            while(!_tokens.empty() && !_destroyed)
+            while(!_destroyed)
             {
                 const IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
-                const Token& first = *(_tokens.begin());
-                if(first.scheduledTime <= now)
+                task = _wheel->pop(now, repeated);
+                if(task)
                 {
-                    token = first;
-                    _tokens.erase(_tokens.begin());
-                    if(token.delay == IceUtil::Time())
-                    {
-                        _tasks.erase(token.task);
-                    }
                     break;
                 }
 
-                _wakeUpTime = first.scheduledTime;
+                _wakeUpTime = _wheel->next();
+                if(_wakeUpTime == IceUtil::Time())
+                {
+                    _monitor.wait();
+                    continue;
+                }
+
                 try
                 {
-                    _monitor.timedWait(first.scheduledTime - now);
+                    _monitor.timedWait(_wakeUpTime - now);
                 }
                 catch(const IceUtil::InvalidTimeoutException&)
                 {
-                    IceUtil::Time timeout = (first.scheduledTime - now) / 2;
+                    IceUtil::Time timeout = (_wakeUpTime - now) / 2;
                     while(timeout > IceUtil::Time())
                     {
                         try
@@ -225,11 +203,11 @@ Timer::run()
             }
         }
 
-        if(token.task)
+        if(task)
         {
             try
             {
-                runTimerTask(token.task);
+                runTimerTask(task);
             }
             catch(const IceUtil::Exception& e)
             {
@@ -0,0 +1,434 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/TimerWheel.h>
+
+using namespace std;
+using namespace IceUtil;
+using namespace IceInternal;
+
+namespace
+{
+
+const int wheelBits = 8;
+const int wheelSize = 1 << wheelBits;
+const int wheelLevels = 4;
+const int readyList = wheelLevels * wheelSize;
+
+//
+// Returns the tick of the given time, rounded up for the time of a task
+// to never run a task before its time.
+//
+IceUtil::Int64
+toTick(const IceUtil::Time& start, const IceUtil::Time& time, bool roundUp)
+{
+    IceUtil::Int64 us = (time - start).toMicroSeconds();
+    return roundUp ? (us + 999) / 1000 : us / 1000;
+}
+
+size_t
+hashTask(const TimerTask* task)
+{
+    size_t h = reinterpret_cast<size_t>(task);
+    return (h >> 4) ^ (h >> 16);
+}
+
+}
+
+IceInternal::TimerWheel::TimerWheel(const IceUtil::Time& start) :
+    _start(start),
+    _currentTick(0),
+    _free(-1),
+    _heads(readyList + 1, -1),
+    _tails(readyList + 1, -1),
+    _size(0)
+{
+    fill(_counts, _counts + wheelLevels, 0);
+}
+
+void
+IceInternal::TimerWheel::add(const TimerTaskPtr& task, const IceUtil::Time& delay, const IceUtil::Time& time,
+                             const IceUtil::Time& now)
+{
+    //
+    // The wheel isn't advanced while it's empty, catch up with the
+    // current time to not cascade the task through all the levels.
+    //
+    if(empty())
+    {
+        _currentTick = max(_currentTick, toTick(_start, now, false));
+    }
+
+    int e;
+    if(_free != -1)
+    {
+        e = _free;
+        _free = _entries[e].next;
+    }
+    else
+    {
+        e = static_cast<int>(_entries.size());
+        _entries.push_back(Entry());
+    }
+
+    Entry& entry = _entries[e];
+    entry.task = task;
+    entry.delay = delay;
+    entry.tick = toTick(_start, time, true);
+    entry.list = -1;
+    index(e);
+    place(e);
+}
+
+bool
+IceInternal::TimerWheel::remove(const TimerTaskPtr& task)
+{
+    int e = find(task.get());
+    if(e == -1)
+    {
+        return false;
+    }
+
+    //
+    // The entry of a repeated task isn't linked while the task runs,
+    // reschedule() doesn't place it again once it's released.
+    //
+    if(_entries[e].list != -1)
+    {
+        unlink(e);
+    }
+    unindex(e);
+    release(e);
+    return true;
+}
+
+bool
+IceInternal::TimerWheel::contains(const TimerTaskPtr& task) const
+{
+    return find(task.get()) != -1;
+}
+
+TimerTaskPtr
+IceInternal::TimerWheel::pop(const IceUtil::Time& now, bool& repeated)
+{
+    advance(toTick(_start, now, false));
+
+    int e = _heads[readyList];
+    if(e == -1)
+    {
+        return ICE_NULLPTR;
+    }
+
+    unlink(e);
+    TimerTaskPtr task = _entries[e].task;
+    repeated = _entries[e].delay != IceUtil::Time();
+    if(!repeated)
+    {
+        unindex(e);
+        release(e);
+    }
+    return task;
+}
+
+void
+IceInternal::TimerWheel::reschedule(const TimerTaskPtr& task, const IceUtil::Time& now)
+{
+    int e = find(task.get());
+    if(e != -1 && _entries[e].list == -1)
+    {
+        if(empty())
+        {
+            _currentTick = max(_currentTick, toTick(_start, now, false));
+        }
+        _entries[e].tick = toTick(_start, now + _entries[e].delay, true);
+        place(e);
+    }
+}
+
+IceUtil::Time
+IceInternal::TimerWheel::next() const
+{
+    if(_heads[readyList] != -1)
+    {
+        return _start + IceUtil::Time::milliSeconds(_currentTick);
+    }
+
+    IceUtil::Int64 next = -1;
+    for(int level = 0; level < wheelLevels; ++level)
+    {
+        if(_counts[level] == 0)
+        {
+            continue;
+        }
+
+        const int shift = wheelBits * level;
+        IceUtil::Int64 slot = level == 0 ? _currentTick : (_currentTick >> shift) + 1;
+        for(int i = 0; i < wheelSize; ++i, ++slot)
+        {
+            if(_heads[level * wheelSize + static_cast<int>(slot & (wheelSize - 1))] != -1)
+            {
+                IceUtil::Int64 tick = slot << shift;
+                if(next == -1 || tick < next)
+                {
+                    next = tick;
+                }
+                break;
+            }
+        }
+    }
+    return next == -1 ? IceUtil::Time() : _start + IceUtil::Time::milliSeconds(next);
+}
+
+void
+IceInternal::TimerWheel::clear()
+{
+    _entries.clear();
+    _free = -1;
+    fill(_heads.begin(), _heads.end(), -1);
+    fill(_tails.begin(), _tails.end(), -1);
+    fill(_counts, _counts + wheelLevels, 0);
+    _table.clear();
+    _size = 0;
+}
+
+bool
+IceInternal::TimerWheel::empty() const
+{
+    return _counts[0] == 0 && _counts[1] == 0 && _counts[2] == 0 && _counts[3] == 0;
+}
+
+void
+IceInternal::TimerWheel::release(int e)
+{
+    assert(_entries[e].list == -1);
+    _entries[e].task = ICE_NULLPTR;
+    _entries[e].next = _free;
+    _free = e;
+}
+
+int
+IceInternal::TimerWheel::find(const TimerTask* task) const
+{
+    if(_size == 0)
+    {
+        return -1;
+    }
+
+    const size_t mask = _table.size() - 1;
+    for(size_t i = hashTask(task) & mask; _table[i] != -1; i = (i + 1) & mask)
+    {
+        if(_entries[_table[i]].task.get() == task)
+        {
+            return _table[i];
+        }
+    }
+    return -1;
+}
+
+void
+IceInternal::TimerWheel::index(int e)
+{
+    if((_size + 1) * 4 > _table.size() * 3)
+    {
+        vector<int> table(_table.empty() ? 64 : _table.size() * 2, -1);
+        table.swap(_table);
+        _size = 0;
+        for(vector<int>::const_iterator p = table.begin(); p != table.end(); ++p)
+        {
+            if(*p != -1)
+            {
+                index(*p);
+            }
+        }
+    }
+
+    const size_t mask = _table.size() - 1;
+    size_t i = hashTask(_entries[e].task.get()) & mask;
+    while(_table[i] != -1)
+    {
+        i = (i + 1) & mask;
+    }
+    _table[i] = e;
+    ++_size;
+}
+
+void
+IceInternal::TimerWheel::unindex(int e)
+{
+    const size_t mask = _table.size() - 1;
+    size_t i = hashTask(_entries[e].task.get()) & mask;
+    while(_table[i] != e)
+    {
+        assert(_table[i] != -1);
+        i = (i + 1) & mask;
+    }
+
+    //
+    // Shift back the following entries of the probe sequence, unless
+    // their home slot lies cyclically in (i, j].
+    //
+    size_t j = i;
+    while(true)
+    {
+        j = (j + 1) & mask;
+        if(_table[j] == -1)
+        {
+            break;
+        }
+        const size_t k = hashTask(_entries[_table[j]].task.get()) & mask;
+        if(i <= j ? (i < k && k <= j) : (i < k || k <= j))
+        {
+            continue;
+        }
+        _table[i] = _table[j];
+        i = j;
+    }
+    _table[i] = -1;
+    --_size;
+}
+
+void
+IceInternal::TimerWheel::place(int e)
+{
+    IceUtil::Int64 tick = _entries[e].tick;
+    if(tick < _currentTick)
+    {
+        link(e, readyList);
+        return;
+    }
+
+    //
+    // The level is the lowest level whose turn covers the delay. Tasks
+    // beyond the turn of the highest level are placed in its last slot
+    // and placed again when the wheel reaches this slot.
+    //
+    IceUtil::Int64 delta = tick - _currentTick;
+    int level = 0;
+    while(level < wheelLevels - 1 && delta >= (ICE_INT64(1) << (wheelBits * (level + 1))))
+    {
+        ++level;
+    }
+    if(delta >= (ICE_INT64(1) << (wheelBits * wheelLevels)))
+    {
+        tick = _currentTick + (ICE_INT64(1) << (wheelBits * wheelLevels)) - 1;
+    }
+    link(e, level * wheelSize + static_cast<int>((tick >> (wheelBits * level)) & (wheelSize - 1)));
+}
+
+void
+IceInternal::TimerWheel::link(int e, int list)
+{
+    Entry& entry = _entries[e];
+    entry.list = list;
+    entry.prev = _tails[list];
+    entry.next = -1;
+    if(entry.prev != -1)
+    {
+        _entries[entry.prev].next = e;
+    }
+    else
+    {
+        _heads[list] = e;
+    }
+    _tails[list] = e;
+    if(list != readyList)
+    {
+        ++_counts[list / wheelSize];
+    }
+}
+
+void
+IceInternal::TimerWheel::unlink(int e)
+{
+    Entry& entry = _entries[e];
+    if(entry.prev != -1)
+    {
+        _entries[entry.prev].next = entry.next;
+    }
+    else
+    {
+        _heads[entry.list] = entry.next;
+    }
+    if(entry.next != -1)
+    {
+        _entries[entry.next].prev = entry.prev;
+    }
+    else
+    {
+        _tails[entry.list] = entry.prev;
+    }
+    if(entry.list != readyList)
+    {
+        --_counts[entry.list / wheelSize];
+    }
+    entry.list = -1;
+}
+
+void
+IceInternal::TimerWheel::cascade(int level)
+{
+    int list = level * wheelSize + static_cast<int>((_currentTick >> (wheelBits * level)) & (wheelSize - 1));
+    int e = _heads[list];
+    while(e != -1)
+    {
+        int next = _entries[e].next;
+        unlink(e);
+        place(e);
+        e = next;
+    }
+}
+
+void
+IceInternal::TimerWheel::advance(IceUtil::Int64 tick)
+{
+    while(_currentTick <= tick)
+    {
+        if(empty())
+        {
+            _currentTick = tick + 1;
+            break;
+        }
+
+        //
+        // When the lowest level completes a turn, move the tasks of the
+        // next slot of each level down, starting with the lowest level.
+        //
+        for(int level = 1; level < wheelLevels; ++level)
+        {
+            if((_currentTick & ((ICE_INT64(1) << (wheelBits * level)) - 1)) != 0)
+            {
+                break;
+            }
+            cascade(level);
+        }
+
+        int list = static_cast<int>(_currentTick & (wheelSize - 1));
+        int e = _heads[list];
+        while(e != -1)
+        {
+            int next = _entries[e].next;
+            unlink(e);
+            link(e, readyList);
+            e = next;
+        }
+        ++_currentTick;
+
+        //
+        // Skip the turns of the levels without tasks.
+        //
+        for(int level = 0; level < wheelLevels && _counts[level] == 0; ++level)
+        {
+            IceUtil::Int64 mask = (ICE_INT64(1) << (wheelBits * (level + 1))) - 1;
+            if((_currentTick & mask) != 0)
+            {
+                _currentTick = min(tick + 1, (_currentTick | mask) + 1);
+            }
+        }
+    }
+}
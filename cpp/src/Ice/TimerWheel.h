@@ -0,0 +1,117 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_TIMER_WHEEL_H
+#define ICE_TIMER_WHEEL_H
+
+#include <IceUtil/Timer.h>
+
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The tasks of IceUtil::Timer are kept in a hierarchical timing wheel
+// with a tick of one millisecond. Each level has 256 slots and a slot
+// spans a full turn of the level below, the tasks of a slot are moved to
+// the level below when the wheel reaches the slot. Adding and removing a
+// task are constant time operations.
+//
+// The task entries are stored in a vector and linked by index in the list
+// of their slot or in the list of the tasks ready to run. The entries are
+// indexed by task with an open-addressed table.
+//
+// The wheel isn't thread safe, the times are given by the caller.
+//
+class TimerWheel
+{
+public:
+
+    //
+    // The wheel starts at the given time, the time of its first tick.
+    //
+    TimerWheel(const IceUtil::Time&);
+
+    //
+    // Add a task to run at the given time. The delay is the delay between
+    // the executions of a repeated task and zero otherwise.
+    //
+    void add(const IceUtil::TimerTaskPtr&, const IceUtil::Time&, const IceUtil::Time&, const IceUtil::Time&);
+
+    //
+    // Remove a task, returns false if the task isn't in the wheel.
+    //
+    bool remove(const IceUtil::TimerTaskPtr&);
+
+    bool contains(const IceUtil::TimerTaskPtr&) const;
+
+    //
+    // Returns a task whose time is before the given time, or null if no
+    // task is ready. A repeated task stays in the wheel while it runs and
+    // must be rescheduled once it ran.
+    //
+    IceUtil::TimerTaskPtr pop(const IceUtil::Time&, bool&);
+
+    //
+    // Reschedule a repeated task after its execution. Does nothing if the
+    // task was removed while it ran.
+    //
+    void reschedule(const IceUtil::TimerTaskPtr&, const IceUtil::Time&);
+
+    //
+    // Returns the time of the next task of the lowest level or the time at
+    // which the next slot with tasks of a higher level is moved down, the
+    // earliest of these times. Returns zero if the wheel is empty.
+    //
+    IceUtil::Time next() const;
+
+    void clear();
+
+private:
+
+    // noncopyable
+    TimerWheel(const TimerWheel&);
+    void operator=(const TimerWheel&);
+
+    struct Entry
+    {
+        IceUtil::TimerTaskPtr task;
+        IceUtil::Time delay; // Zero if the task isn't repeated.
+        IceUtil::Int64 tick; // The tick at which the task runs.
+        int list; // The slot or ready list of the entry, -1 if not linked.
+        int prev;
+        int next;
+    };
+
+    bool empty() const;
+    void release(int);
+    int find(const IceUtil::TimerTask*) const;
+    void index(int);
+    void unindex(int);
+    void place(int);
+    void link(int, int);
+    void unlink(int);
+    void cascade(int);
+    void advance(IceUtil::Int64);
+
+    const IceUtil::Time _start;
+    IceUtil::Int64 _currentTick; // The next tick to process.
+    std::vector<Entry> _entries;
+    int _free;
+    std::vector<int> _heads;
+    std::vector<int> _tails;
+    int _counts[4]; // The number of entries of each level.
+    std::vector<int> _table;
+    size_t _size;
+};
+
+}
+
+#endif
@@ -30,7 +30,9 @@ IceInternal::TraceLevels::TraceLevels(const PropertiesPtr& properties) :
     gc(0),
     gcCat("GC"),
     threadPool(0),
-    threadPoolCat("ThreadPool")
+    threadPoolCat("ThreadPool"),
+    bufferPool(0),
+    bufferPoolCat("BufferPool")
 {
     const string keyBase = "Ice.Trace.";
     const_cast<int&>(network) = properties->getPropertyAsInt(keyBase + networkCat);
@@ -40,4 +42,5 @@ IceInternal::TraceLevels::TraceLevels(const PropertiesPtr& properties) :
     const_cast<int&>(slicing) = properties->getPropertyAsInt(keyBase + slicingCat);
     const_cast<int&>(gc) = properties->getPropertyAsInt(keyBase + gcCat);
     const_cast<int&>(threadPool) = properties->getPropertyAsInt(keyBase + threadPoolCat);
+    const_cast<int&>(bufferPool) = properties->getPropertyAsInt(keyBase + bufferPoolCat);
 }
@@ -20,6 +20,7 @@
 #include <Ice/InputStream.h>
 #include <Ice/Protocol.h>
 #include <Ice/ReplyStatus.h>
+#include <Ice/Codec.h>
 #include <set>
 
 using namespace std;
@@ -181,7 +182,19 @@ printHeader(ostream& s, InputStream& stream)
 
         default:
         {
-            s << "(unknown)";
+            const Codec* codec = getCodec(static_cast<Byte>(compress & ~codecStatusFlag));
+            if(!codec)
+            {
+                s << "(unknown)";
+            }
+            else if(compress & codecStatusFlag)
+            {
+                s << "(not compressed; compress response with " << codec->name() << ", if any)";
+            }
+            else
+            {
+                s << "(compressed with " << codec->name() << "; compress response, if any)";
+            }
             break;
         }
     }
@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Transceiver.h>
+#include <Ice/Buffer.h>
 
 using namespace std;
 using namespace Ice;
@@ -21,3 +22,30 @@ IceInternal::Transceiver::bind()
     assert(false);
     return 0;
 }
+
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+bool
+IceInternal::Transceiver::supportsWritev() const
+{
+    return false;
+}
+
+bool
+IceInternal::Transceiver::supportsReadAhead() const
+{
+    return false;
+}
+
+SocketOperation
+IceInternal::Transceiver::writev(const vector<Buffer*>& buffers)
+{
+    for(vector<Buffer*>::const_iterator p = buffers.begin(); p != buffers.end(); ++p)
+    {
+        if((*p)->i != (*p)->b.end())
+        {
+            return write(**p);
+        }
+    }
+    return SocketOperationNone;
+}
+#endif
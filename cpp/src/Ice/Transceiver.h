@@ -16,6 +16,8 @@
 #include <Ice/EndpointIF.h>
 #include <Ice/Network.h>
 
+#include <vector>
+
 namespace IceInternal
 {
 
@@ -39,6 +41,23 @@ public:
     virtual void finishWrite(Buffer&) = 0;
     virtual void startRead(Buffer&) = 0;
     virtual void finishRead(Buffer&) = 0;
+#else
+    //
+    // Transceivers which can write several buffers with a single
+    // system call return true from supportsWritev and override
+    // writev. The default implementation only writes the first
+    // buffer which isn't fully written. Datagram transceivers send
+    // each buffer as a separate datagram.
+    //
+    virtual bool supportsWritev() const;
+    virtual SocketOperation writev(const std::vector<Buffer*>&);
+
+    //
+    // Returns true if the connection can read ahead more data than
+    // requested from this transceiver. Transceivers which buffer or
+    // frame the data they read return false.
+    //
+    virtual bool supportsReadAhead() const;
 #endif
 
     virtual std::string protocol() const = 0;
@@ -20,7 +20,7 @@ using namespace IceInternal;
 TransceiverPtr
 IceInternal::UdpConnector::connect()
 {
-    return new UdpTransceiver(_instance, _addr, _sourceAddr, _mcastInterface, _mcastTtl);
+    return new UdpTransceiver(_instance, _addr, _sourceAddr, _mcastInterface, _mcastTtl, _batchSize);
 }
 
 Short
@@ -58,6 +58,11 @@ IceInternal::UdpConnector::operator==(const Connector& r) const
         return false;
     }
 
+    if(_batchSize != p->_batchSize)
+    {
+        return false;
+    }
+
     if(_mcastInterface != p->_mcastInterface)
     {
         return false;
@@ -98,6 +103,15 @@ IceInternal::UdpConnector::operator<(const Connector& r) const
         return false;
     }
 
+    if(_batchSize < p->_batchSize)
+    {
+        return true;
+    }
+    else if(p->_batchSize < _batchSize)
+    {
+        return false;
+    }
+
     if(_mcastInterface < p->_mcastInterface)
     {
         return true;
@@ -121,7 +135,7 @@ IceInternal::UdpConnector::operator<(const Connector& r) const
 
 IceInternal::UdpConnector::UdpConnector(const ProtocolInstancePtr& instance, const Address& addr,
                                         const Address& sourceAddr, const string& mcastInterface, int mcastTtl,
-                                        const std::string& connectionId) :
+                                        int batchSize, const std::string& connectionId) :
     _instance(instance),
     _addr(addr),
 #ifndef ICE_OS_UWP
@@ -129,6 +143,7 @@ IceInternal::UdpConnector::UdpConnector(const ProtocolInstancePtr& instance, con
 #endif
     _mcastInterface(mcastInterface),
     _mcastTtl(mcastTtl),
+    _batchSize(batchSize),
     _connectionId(connectionId)
 {
 }
@@ -32,7 +32,7 @@ public:
 
 private:
 
-    UdpConnector(const ProtocolInstancePtr&, const Address&, const Address&, const std::string&, int,
+    UdpConnector(const ProtocolInstancePtr&, const Address&, const Address&, const std::string&, int, int,
                  const std::string&);
 
     virtual ~UdpConnector();
@@ -43,6 +43,7 @@ private:
     const Address _sourceAddr;
     const std::string _mcastInterface;
     const int _mcastTtl;
+    const int _batchSize;
     const std::string _connectionId;
 };
 
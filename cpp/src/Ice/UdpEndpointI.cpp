@@ -27,6 +27,16 @@ using namespace IceInternal;
 IceUtil::Shared* IceInternal::upCast(UdpEndpointI* p) { return p; }
 #endif
 
+namespace
+{
+
+//
+// recvmmsg and sendmmsg process at most UIO_MAXIOV messages per call.
+//
+const Int maxBatchSize = 1024;
+
+}
+
 extern "C"
 {
 
@@ -59,11 +69,12 @@ ICEregisterIceUDP(bool loadOnInitialize)
 }
 
 IceInternal::UdpEndpointI::UdpEndpointI(const ProtocolInstancePtr& instance, const string& host, Int port,
-                                        const Address& sourceAddr, const string& mcastInterface, Int mttl, bool conn,
-                                        const string& conId, bool co) :
+                                        const Address& sourceAddr, const string& mcastInterface, Int mttl,
+                                        Int batchSize, bool conn, const string& conId, bool co) :
     IPEndpointI(instance, host, port, sourceAddr, conId),
     _mcastTtl(mttl),
     _mcastInterface(mcastInterface),
+    _batchSize(batchSize),
     _connect(conn),
     _compress(co)
 {
@@ -72,6 +83,7 @@ IceInternal::UdpEndpointI::UdpEndpointI(const ProtocolInstancePtr& instance, con
 IceInternal::UdpEndpointI::UdpEndpointI(const ProtocolInstancePtr& instance) :
     IPEndpointI(instance),
     _mcastTtl(-1),
+    _batchSize(1),
     _connect(false),
     _compress(false)
 {
@@ -80,6 +92,7 @@ IceInternal::UdpEndpointI::UdpEndpointI(const ProtocolInstancePtr& instance) :
 IceInternal::UdpEndpointI::UdpEndpointI(const ProtocolInstancePtr& instance, InputStream* s) :
     IPEndpointI(instance, s),
     _mcastTtl(-1),
+    _batchSize(1),
     _connect(false),
     _compress(false)
 {
@@ -147,7 +160,7 @@ IceInternal::UdpEndpointI::compress(bool compress) const
     else
     {
         return ICE_MAKE_SHARED(UdpEndpointI, _instance, _host, _port, _sourceAddr, _mcastInterface, _mcastTtl,
-                               _connect, _connectionId, compress);
+                               _batchSize, _connect, _connectionId, compress);
     }
 }
 
@@ -161,7 +174,7 @@ TransceiverPtr
 IceInternal::UdpEndpointI::transceiver() const
 {
     return new UdpTransceiver(ICE_DYNAMIC_CAST(UdpEndpointI, ICE_SHARED_FROM_CONST_THIS(UdpEndpointI)), _instance,
-                              _host, _port, _mcastInterface, _connect);
+                              _host, _port, _mcastInterface, _batchSize, _connect);
 }
 
 AcceptorPtr
@@ -180,8 +193,8 @@ IceInternal::UdpEndpointI::endpoint(const UdpTransceiverPtr& transceiver) const
     }
     else
     {
-        return ICE_MAKE_SHARED(UdpEndpointI, _instance, _host, port, _sourceAddr, _mcastInterface,_mcastTtl, _connect,
-                               _connectionId, _compress);
+        return ICE_MAKE_SHARED(UdpEndpointI, _instance, _host, port, _sourceAddr, _mcastInterface, _mcastTtl, _batchSize,
+                               _connect, _connectionId, _compress);
     }
 }
 
@@ -227,6 +240,11 @@ IceInternal::UdpEndpointI::options() const
         s << " --ttl " << _mcastTtl;
     }
 
+    if(_batchSize != 1)
+    {
+        s << " --batch " << _batchSize;
+    }
+
     if(_connect)
     {
         s << " -c";
@@ -283,6 +301,11 @@ IceInternal::UdpEndpointI::operator==(const LocalObject& r) const
         return false;
     }
 
+    if(_batchSize != p->_batchSize)
+    {
+        return false;
+    }
+
     return true;
 }
 
@@ -345,6 +368,15 @@ IceInternal::UdpEndpointI::operator<(const LocalObject& r) const
         return false;
     }
 
+    if(_batchSize < p->_batchSize)
+    {
+        return true;
+    }
+    else if(p->_batchSize < _batchSize)
+    {
+        return false;
+    }
+
     return IPEndpointI::operator<(r);
 }
 
@@ -354,6 +386,7 @@ IceInternal::UdpEndpointI::hashInit(Ice::Int& h) const
     IPEndpointI::hashInit(h);
     hashAdd(h, _mcastInterface);
     hashAdd(h, _mcastTtl);
+    hashAdd(h, _batchSize);
     hashAdd(h, _connect);
     hashAdd(h, _compress);
 }
@@ -443,6 +476,27 @@ IceInternal::UdpEndpointI::checkOption(const string& option, const string& argum
                                          endpoint);
         }
     }
+    else if(option == "--batch")
+    {
+        if(argument.empty())
+        {
+            throw EndpointParseException(__FILE__, __LINE__, "no argument provided for --batch option in endpoint " +
+                                         endpoint);
+        }
+        istringstream p(argument);
+        if(!(p >> const_cast<Int&>(_batchSize)) || !p.eof() || _batchSize < 1)
+        {
+            throw EndpointParseException(__FILE__, __LINE__, "invalid batch size `" + argument + "' in endpoint " +
+                                         endpoint);
+        }
+        if(_batchSize > maxBatchSize)
+        {
+            ostringstream os;
+            os << "batch size `" << argument << "' in endpoint " << endpoint << " exceeds the maximum of "
+               << maxBatchSize;
+            throw EndpointParseException(__FILE__, __LINE__, os.str());
+        }
+    }
     else
     {
         return false;
@@ -453,14 +507,14 @@ IceInternal::UdpEndpointI::checkOption(const string& option, const string& argum
 ConnectorPtr
 IceInternal::UdpEndpointI::createConnector(const Address& address, const NetworkProxyPtr&) const
 {
-    return new UdpConnector(_instance, address, _sourceAddr, _mcastInterface, _mcastTtl, _connectionId);
+    return new UdpConnector(_instance, address, _sourceAddr, _mcastInterface, _mcastTtl, _batchSize, _connectionId);
 }
 
 IPEndpointIPtr
 IceInternal::UdpEndpointI::createEndpoint(const string& host, int port, const string& connectionId) const
 {
-    return ICE_MAKE_SHARED(UdpEndpointI, _instance, host, port, _sourceAddr, _mcastInterface, _mcastTtl, _connect,
-                           connectionId, _compress);
+    return ICE_MAKE_SHARED(UdpEndpointI, _instance, host, port, _sourceAddr, _mcastInterface, _mcastTtl, _batchSize,
+                           _connect, connectionId, _compress);
 }
 
 IceInternal::UdpEndpointFactory::UdpEndpointFactory(const ProtocolInstancePtr& instance) : _instance(instance)
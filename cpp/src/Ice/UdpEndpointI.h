@@ -23,7 +23,7 @@ class UdpEndpointI : public IPEndpointI
 public:
 
     UdpEndpointI(const ProtocolInstancePtr&, const std::string&, Ice::Int, const Address&, const std::string&,
-                 Ice::Int, bool, const std::string&, bool);
+                 Ice::Int, Ice::Int, bool, const std::string&, bool);
     UdpEndpointI(const ProtocolInstancePtr&);
     UdpEndpointI(const ProtocolInstancePtr&, Ice::InputStream*);
 
@@ -71,6 +71,7 @@ private:
     //
     const Ice::Int _mcastTtl;
     const std::string _mcastInterface;
+    const Ice::Int _batchSize;
     const bool _connect;
     const bool _compress;
 };
@@ -263,6 +263,13 @@ IceInternal::UdpTransceiver::read(Buffer& buf)
     assert(buf.i == buf.b.begin());
     assert(_fd != INVALID_SOCKET);
 
+#   if defined(__linux)
+    if(_batchSize > 1 && _state != StateNeedConnect)
+    {
+        return readBatch(buf);
+    }
+#   endif
+
     const int packetSize = min(_maxPacketSize, _rcvSize - _udpOverhead);
     buf.b.resize(packetSize);
     buf.i = buf.b.begin();
@@ -351,6 +358,196 @@ repeat:
 #endif
 }
 
+#if defined(__linux) && !defined(ICE_OS_UWP)
+bool
+IceInternal::UdpTransceiver::supportsWritev() const
+{
+    return _batchSize > 1;
+}
+
+SocketOperation
+IceInternal::UdpTransceiver::writev(const vector<Buffer*>& buffers)
+{
+    assert(_fd != INVALID_SOCKET && _state >= StateConnected);
+
+    sockaddr* peerAddr = 0;
+    socklen_t len = 0;
+    if(_state != StateConnected)
+    {
+        if(_peerAddr.saStorage.ss_family == AF_INET)
+        {
+            len = static_cast<socklen_t>(sizeof(sockaddr_in));
+        }
+        else if(_peerAddr.saStorage.ss_family == AF_INET6)
+        {
+            len = static_cast<socklen_t>(sizeof(sockaddr_in6));
+        }
+        else
+        {
+            // No peer has sent a datagram yet.
+            throw SocketException(__FILE__, __LINE__, 0);
+        }
+        peerAddr = &_peerAddr.sa;
+    }
+
+    //
+    // Send each buffer as a separate datagram, up to _batchSize
+    // datagrams with a single system call.
+    //
+    const size_t count = min(buffers.size(), static_cast<size_t>(_batchSize));
+    _sendMessages.resize(count);
+    _sendVectors.resize(count);
+    for(size_t i = 0; i < count; ++i)
+    {
+        Buffer* buf = buffers[i];
+        assert(buf->i == buf->b.begin());
+
+        // The caller is supposed to check the send size before by calling checkSendSize
+        assert(min(_maxPacketSize, _sndSize - _udpOverhead) >= static_cast<int>(buf->b.size()));
+
+        _sendVectors[i].iov_base = buf->b.begin();
+        _sendVectors[i].iov_len = buf->b.size();
+        memset(&_sendMessages[i], 0, sizeof(mmsghdr));
+        _sendMessages[i].msg_hdr.msg_iov = &_sendVectors[i];
+        _sendMessages[i].msg_hdr.msg_iovlen = 1;
+        _sendMessages[i].msg_hdr.msg_name = peerAddr;
+        _sendMessages[i].msg_hdr.msg_namelen = len;
+    }
+
+repeat:
+
+    int ret = ::sendmmsg(_fd, &_sendMessages[0], static_cast<unsigned int>(count), 0);
+    if(ret == SOCKET_ERROR)
+    {
+        if(interrupted())
+        {
+            goto repeat;
+        }
+
+        if(wouldBlock())
+        {
+            return SocketOperationWrite;
+        }
+
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+
+    for(int i = 0; i < ret; ++i)
+    {
+        assert(_sendMessages[i].msg_len == buffers[i]->b.size());
+        buffers[i]->i = buffers[i]->b.end();
+    }
+    return static_cast<size_t>(ret) < buffers.size() ? SocketOperationWrite : SocketOperationNone;
+}
+
+SocketOperation
+IceInternal::UdpTransceiver::readBatch(Buffer& buf)
+{
+    if(_batchPos == _batchCount)
+    {
+        //
+        // Receive up to _batchSize datagrams with a single system call.
+        // The datagrams are returned one at a time, the transceiver
+        // remains ready for reading until they are all returned.
+        //
+        const int packetSize = min(_maxPacketSize, _rcvSize - _udpOverhead);
+        if(packetSize != _batchPacketSize)
+        {
+            //
+            // Each datagram requires a buffer of the maximum packet size,
+            // the number of datagrams received at once is limited to keep
+            // the memory of these buffers under _maxBatchMemory.
+            //
+            const size_t count = static_cast<size_t>(max(1, min(_batchSize, _maxBatchMemory / packetSize)));
+            delete[] _batchBuffers;
+            _batchBuffers = new Buffer::Container[count];
+            _batchMessages.resize(count);
+            _batchVectors.resize(count);
+            _batchAddrs.resize(count);
+            _batchPacketSize = packetSize;
+        }
+
+        for(size_t i = 0; i < _batchMessages.size(); ++i)
+        {
+            //
+            // The buffers of the datagrams returned by the previous batch
+            // were swapped with the buffers given to read, they're resized
+            // to the packet size if needed.
+            //
+            _batchBuffers[i].resize(static_cast<size_t>(packetSize));
+            _batchVectors[i].iov_base = &_batchBuffers[i][0];
+            _batchVectors[i].iov_len = static_cast<size_t>(packetSize);
+            memset(&_batchMessages[i], 0, sizeof(mmsghdr));
+            _batchMessages[i].msg_hdr.msg_iov = &_batchVectors[i];
+            _batchMessages[i].msg_hdr.msg_iovlen = 1;
+            if(_state != StateConnected)
+            {
+                memset(&_batchAddrs[i].saStorage, 0, sizeof(sockaddr_storage));
+                _batchMessages[i].msg_hdr.msg_name = &_batchAddrs[i].saStorage;
+                _batchMessages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(sizeof(sockaddr_storage));
+            }
+        }
+
+    repeat:
+
+        int ret = ::recvmmsg(_fd, &_batchMessages[0], static_cast<unsigned int>(_batchMessages.size()), 0, 0);
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                goto repeat;
+            }
+
+            if(wouldBlock())
+            {
+                return SocketOperationRead;
+            }
+
+            if(connectionLost())
+            {
+                throw ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+        else if(ret == 0)
+        {
+            return SocketOperationRead;
+        }
+
+        _batchCount = ret;
+        _batchPos = 0;
+        if(_batchCount > 1)
+        {
+            ready(SocketOperationRead, true);
+        }
+    }
+
+    const size_t pos = static_cast<size_t>(_batchPos);
+    if(_state != StateConnected)
+    {
+        _peerAddr = _batchAddrs[pos];
+    }
+
+    //
+    // A truncated datagram fills the whole packet, it's detected at the
+    // connection level when the Ice message size is checked against
+    // the buffer size.
+    //
+    buf.b.swap(_batchBuffers[pos]);
+    buf.b.resize(_batchMessages[pos].msg_len);
+    buf.i = buf.b.end();
+
+    if(++_batchPos == _batchCount && _batchCount > 1)
+    {
+        ready(SocketOperationRead, false);
+    }
+    return SocketOperationNone;
+}
+#endif
+
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
 bool
 IceInternal::UdpTransceiver::startWrite(Buffer& buf)
@@ -882,18 +1079,25 @@ IceInternal::UdpTransceiver::UdpTransceiver(const ProtocolInstancePtr& instance,
 #ifdef ICE_OS_UWP
                                             const Address&,
                                             const string&,
-                                            int
+                                            int,
 #else
                                             const Address& sourceAddr,
                                             const string& mcastInterface,
-                                            int mcastTtl
+                                            int mcastTtl,
 #endif
-                                            ) :
+                                            int batchSize) :
     _instance(instance),
     _incoming(false),
     _bound(false),
     _addr(addr),
-    _state(StateNeedConnect)
+    _state(StateNeedConnect),
+    _batchSize(batchSize)
+#if defined(__linux) && !defined(ICE_OS_UWP)
+    , _batchBuffers(0),
+    _batchPacketSize(0),
+    _batchCount(0),
+    _batchPos(0)
+#endif
 #if defined(ICE_USE_IOCP)
     , _read(SocketOperationRead),
     _write(SocketOperationWrite)
@@ -966,7 +1170,8 @@ IceInternal::UdpTransceiver::UdpTransceiver(const ProtocolInstancePtr& instance,
 }
 
 IceInternal::UdpTransceiver::UdpTransceiver(const UdpEndpointIPtr& endpoint, const ProtocolInstancePtr& instance,
-                                            const string& host, int port, const string& mcastInterface, bool connect) :
+                                            const string& host, int port, const string& mcastInterface,
+                                            int batchSize, bool connect) :
     _endpoint(endpoint),
     _instance(instance),
     _incoming(true),
@@ -974,7 +1179,14 @@ IceInternal::UdpTransceiver::UdpTransceiver(const UdpEndpointIPtr& endpoint, con
     _addr(getAddressForServer(host, port, instance->protocolSupport(), instance->preferIPv6(), true)),
     _mcastInterface(mcastInterface),
     _port(port),
-    _state(connect ? StateNeedConnect : StateNotConnected)
+    _state(connect ? StateNeedConnect : StateNotConnected),
+    _batchSize(batchSize)
+#if defined(__linux) && !defined(ICE_OS_UWP)
+    , _batchBuffers(0),
+    _batchPacketSize(0),
+    _batchCount(0),
+    _batchPos(0)
+#endif
 #ifdef ICE_OS_UWP
     , _readPending(false)
 #elif defined(ICE_USE_IOCP)
@@ -1013,6 +1225,9 @@ IceInternal::UdpTransceiver::UdpTransceiver(const UdpEndpointIPtr& endpoint, con
 IceInternal::UdpTransceiver::~UdpTransceiver()
 {
     assert(_fd == INVALID_SOCKET);
+#if defined(__linux) && !defined(ICE_OS_UWP)
+    delete[] _batchBuffers;
+#endif
 }
 
 //
@@ -1155,3 +1370,4 @@ IceInternal::UdpTransceiver::appendMessage(DatagramSocketMessageReceivedEventArg
 //
 const int IceInternal::UdpTransceiver::_udpOverhead = 20 + 8;
 const int IceInternal::UdpTransceiver::_maxPacketSize = 65535 - _udpOverhead;
+const int IceInternal::UdpTransceiver::_maxBatchMemory = 1024 * 1024;
@@ -53,6 +53,9 @@ public:
     virtual void finishWrite(Buffer&);
     virtual void startRead(Buffer&);
     virtual void finishRead(Buffer&);
+#elif defined(__linux)
+    virtual bool supportsWritev() const;
+    virtual SocketOperation writev(const std::vector<Buffer*>&);
 #endif
     virtual std::string protocol() const;
     virtual std::string toString() const;
@@ -65,14 +68,18 @@ public:
 
 private:
 
-    UdpTransceiver(const ProtocolInstancePtr&, const Address&, const Address&, const std::string&, int);
+    UdpTransceiver(const ProtocolInstancePtr&, const Address&, const Address&, const std::string&, int, int);
     UdpTransceiver(const UdpEndpointIPtr&, const ProtocolInstancePtr&, const std::string&, int, const std::string&,
-                   bool);
+                   int, bool);
 
     virtual ~UdpTransceiver();
 
     void setBufSize(int, int);
 
+#if defined(__linux) && !defined(ICE_OS_UWP)
+    SocketOperation readBatch(Buffer&);
+#endif
+
 #ifdef ICE_OS_UWP
     void appendMessage(Windows::Networking::Sockets::DatagramSocketMessageReceivedEventArgs^);
     Windows::Networking::Sockets::DatagramSocketMessageReceivedEventArgs^ readMessage();
@@ -101,8 +108,27 @@ private:
     State _state;
     int _rcvSize;
     int _sndSize;
+    const int _batchSize;
     static const int _udpOverhead;
     static const int _maxPacketSize;
+    static const int _maxBatchMemory;
+
+#if defined(__linux) && !defined(ICE_OS_UWP)
+    //
+    // The datagrams received with a single recvmmsg call, they are
+    // returned one at a time by read. Each datagram is received in its
+    // own buffer which is swapped with the buffer given to read.
+    //
+    Buffer::Container* _batchBuffers;
+    std::vector<mmsghdr> _batchMessages;
+    std::vector<iovec> _batchVectors;
+    std::vector<Address> _batchAddrs;
+    int _batchPacketSize;
+    int _batchCount;
+    int _batchPos;
+    std::vector<mmsghdr> _sendMessages;
+    std::vector<iovec> _sendVectors;
+#endif
 
 #if defined(ICE_USE_IOCP)
     AsyncInfo _read;
@@ -67,6 +67,55 @@ namespace
 const string _iceProtocol = "ice.zeroc.com";
 const string _wsUUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
 
+//
+// The maximum number of payload bytes masked in place at a time, see
+// WSTransceiver::writeMasked.
+//
+const size_t maskWindowSize = 256 * 1024;
+
+//
+// Apply the 32-bit mask to length bytes from src and store the result
+// in dst, which can be src to mask in place. offset is the position of
+// src in the frame payload. Once dst is aligned, the bytes are masked
+// a 64-bit word at a time, which the compiler can further vectorize.
+//
+void applyMask(Byte* dst, const Byte* src, size_t length, const unsigned char mask[4], size_t offset)
+{
+    const Byte* end = src + length;
+    while(src < end && reinterpret_cast<size_t>(dst) % sizeof(Long) != 0)
+    {
+        *dst++ = *src++ ^ mask[offset++ % 4];
+    }
+
+    if(end - src >= static_cast<ptrdiff_t>(sizeof(Long)))
+    {
+        //
+        // Repeat the mask, starting at the current offset, in a word. The
+        // offset doesn't change modulo 4 when masking whole words.
+        //
+        unsigned char bytes[sizeof(Long)];
+        for(size_t i = 0; i < sizeof(Long); ++i)
+        {
+            bytes[i] = mask[(offset + i) % 4];
+        }
+        Long word;
+        memcpy(&word, bytes, sizeof(Long));
+
+        for(; end - src >= static_cast<ptrdiff_t>(sizeof(Long)); src += sizeof(Long), dst += sizeof(Long))
+        {
+            Long v;
+            memcpy(&v, src, sizeof(Long));
+            v ^= word;
+            memcpy(dst, &v, sizeof(Long));
+        }
+    }
+
+    while(src < end)
+    {
+        *dst++ = *src++ ^ mask[offset++ % 4];
+    }
+}
+
 //
 // Rename to avoid conflict with OS 10.10 htonll
 //
@@ -477,6 +526,14 @@ IceInternal::WSTransceiver::close()
     _delegate->close();
     _state = StateClosed;
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    //
+    // Unmask the payload of a partially written message, the connection
+    // returns it to the outgoing call which might retry it.
+    //
+    unmaskWindow();
+#endif
+
     //
     // Clear the buffers now instead of waiting for destruction.
     //
@@ -514,6 +571,17 @@ IceInternal::WSTransceiver::write(Buffer& buf)
     {
         if(preWrite(buf))
         {
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+            if(!_incoming && _writeState == WriteStatePayload && _delegate->supportsWritev())
+            {
+                SocketOperation s = writeMasked(buf);
+                if(s)
+                {
+                    return s;
+                }
+            }
+            else
+#endif
             if(_writeBuffer.i < _writeBuffer.b.end())
             {
                 SocketOperation s = _delegate->write(_writeBuffer);
@@ -866,6 +934,11 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _readPayloadLength(0),
     _writeState(WriteStateHeader),
     _writeBufferSize(16 * 1024),
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    _maskStart(0),
+    _maskEnd(0),
+    _maskOffset(0),
+#endif
     _readPending(false),
     _writePending(false),
     _closingInitiator(false),
@@ -874,9 +947,10 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     //
     // Use 1KB read and 16KB write buffer sizes. We use 16KB for the
     // write buffer size because all the data needs to be copied to
-    // the write buffer for the purpose of masking. A 16KB buffer
-    // appears to be a good compromise to reduce the number of socket
-    // write calls and not consume too much memory.
+    // the write buffer for the purpose of masking, unless the delegate
+    // supports gather writes (see writeMasked). A 16KB buffer appears
+    // to be a good compromise to reduce the number of socket write
+    // calls and not consume too much memory.
     //
 }
 
@@ -894,6 +968,11 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _readPayloadLength(0),
     _writeState(WriteStateHeader),
     _writeBufferSize(1024),
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    _maskStart(0),
+    _maskEnd(0),
+    _maskOffset(0),
+#endif
     _readPending(false),
     _writePending(false),
     _closingInitiator(false),
@@ -1436,11 +1515,8 @@ IceInternal::WSTransceiver::postRead(Buffer& buf)
         //
         // Unmask the data we just read.
         //
-        IceInternal::Buffer::Container::iterator p = _readStart;
-        for(size_t n = _readStart - _readFrameStart; p < buf.i; ++p, ++n)
-        {
-            *p ^= _readMask[n % 4];
-        }
+        applyMask(_readStart, _readStart, static_cast<size_t>(buf.i - _readStart), _readMask,
+                  static_cast<size_t>(_readStart - _readFrameStart));
     }
 
     _readPayloadLength -= buf.i - _readStart;
@@ -1469,6 +1545,13 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
 
             assert(buf.i = buf.b.begin());
             prepareWriteHeader(OP_DATA, buf.b.size());
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+            if(!_incoming && _delegate->supportsWritev())
+            {
+                _writeBuffer.b.resize(_writeBuffer.i - _writeBuffer.b.begin());
+                _writeBuffer.i = _writeBuffer.b.begin();
+            }
+#endif
 
             _writeState = WriteStatePayload;
         }
@@ -1537,6 +1620,12 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
         // larger, the reminder is sent directly from the message buffer to avoid
         // copying.
         //
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+        if(!_incoming && _delegate->supportsWritev())
+        {
+            return true; // The message is masked in place by writeMasked.
+        }
+#endif
 
         if(!_incoming && (_writePayloadLength == 0 || _writeBuffer.i == _writeBuffer.b.end()))
         {
@@ -1546,10 +1635,10 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
             }
 
             size_t n = buf.i - buf.b.begin();
-            for(; n < buf.b.size() && _writeBuffer.i < _writeBuffer.b.end(); ++_writeBuffer.i, ++n)
-            {
-                *_writeBuffer.i = buf.b[n] ^ _writeMask[n % 4];
-            }
+            size_t length = min(buf.b.size() - n, static_cast<size_t>(_writeBuffer.b.end() - _writeBuffer.i));
+            applyMask(_writeBuffer.i, &buf.b[n], length, _writeMask, n);
+            _writeBuffer.i += length;
+            n += length;
             _writePayloadLength = n;
             if(_writeBuffer.i < _writeBuffer.b.end())
             {
@@ -1662,6 +1751,70 @@ IceInternal::WSTransceiver::postWrite(Buffer& buf)
     return false;
 }
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+SocketOperation
+IceInternal::WSTransceiver::writeMasked(Buffer& buf)
+{
+    //
+    // Mask the payload of an outgoing frame in place and write it along
+    // with the frame header using a gather write, instead of copying it
+    // to the write buffer. The payload is masked by windows to bound the
+    // masking of data which can't be written right away. A window stays
+    // masked until it's fully written: the message might be sent again
+    // once written, if the request is retried for example, so the window
+    // is unmasked once written, if the write fails or if the transceiver
+    // is closed.
+    //
+    while(buf.i < buf.b.end())
+    {
+        if(_maskStart == _maskEnd)
+        {
+            _maskStart = buf.i;
+            _maskEnd = buf.i + min(static_cast<size_t>(buf.b.end() - buf.i), maskWindowSize);
+            _maskOffset = static_cast<size_t>(buf.i - buf.b.begin());
+            applyMask(_maskStart, _maskStart, static_cast<size_t>(_maskEnd - _maskStart), _writeMask, _maskOffset);
+        }
+        assert(buf.i >= _maskStart && buf.i < _maskEnd);
+
+        Buffer payload(buf.i, _maskEnd);
+        _writeBuffers.clear();
+        _writeBuffers.push_back(&_writeBuffer);
+        _writeBuffers.push_back(&payload);
+        SocketOperation op;
+        try
+        {
+            op = _delegate->writev(_writeBuffers);
+        }
+        catch(...)
+        {
+            unmaskWindow();
+            throw;
+        }
+
+        buf.i = payload.i;
+        if(buf.i == _maskEnd)
+        {
+            unmaskWindow();
+        }
+        if(op)
+        {
+            return op;
+        }
+    }
+    return SocketOperationNone;
+}
+
+void
+IceInternal::WSTransceiver::unmaskWindow()
+{
+    if(_maskStart != _maskEnd)
+    {
+        applyMask(_maskStart, _maskStart, static_cast<size_t>(_maskEnd - _maskStart), _writeMask, _maskOffset);
+        _maskStart = _maskEnd = 0;
+    }
+}
+#endif
+
 bool
 IceInternal::WSTransceiver::readBuffered(IceInternal::Buffer::Container::size_type sz)
 {
@@ -65,6 +65,10 @@ private:
 
     bool preWrite(Buffer&);
     bool postWrite(Buffer&);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    SocketOperation writeMasked(Buffer&);
+    void unmaskWindow();
+#endif
 
     bool readBuffered(Buffer::Container::size_type);
     void prepareWriteHeader(Ice::Byte, Buffer::Container::size_type);
@@ -131,6 +135,18 @@ private:
     const Buffer::Container::size_type _writeBufferSize;
     unsigned char _writeMask[4];
     size_t _writePayloadLength;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    std::vector<Buffer*> _writeBuffers;
+
+    //
+    // The window of the payload masked in place by writeMasked and its
+    // offset in the payload. The window stays masked until it's fully
+    // written or the transceiver is closed.
+    //
+    Buffer::Container::iterator _maskStart;
+    Buffer::Container::iterator _maskEnd;
+    size_t _maskOffset;
+#endif
 
     bool _readPending;
     bool _writePending;
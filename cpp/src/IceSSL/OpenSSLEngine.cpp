@@ -123,6 +123,18 @@ IceSSL_opensslPasswordCallback(char* buf, int size, int flag, void* userData)
     return sz;
 }
 
+int
+IceSSL_opensslNewSessionCallback(SSL* ssl, SSL_SESSION* session)
+{
+#  if OPENSSL_VERSION_NUMBER >= 0x10100000L && !defined(LIBRESSL_VERSION_NUMBER)
+    SSL_CTX* ctx = SSL_get_SSL_CTX(ssl);
+#  else
+    SSL_CTX* ctx = ssl->ctx;
+#  endif
+    OpenSSL::SSLEngine* p = reinterpret_cast<OpenSSL::SSLEngine*>(SSL_CTX_get_ex_data(ctx, 0));
+    return p->newSession(ssl, session);
+}
+
 #ifndef OPENSSL_NO_DH
 DH*
 IceSSL_opensslDHCallback(SSL* ssl, int /*isExport*/, int keyLength)
@@ -199,7 +211,11 @@ OpenSSL::upCast(OpenSSL::SSLEngine* p)
 
 OpenSSL::SSLEngine::SSLEngine(const CommunicatorPtr& communicator) :
     IceSSL::SSLEngine(communicator),
-    _ctx(0)
+    _ctx(0),
+    _sessionCache(false),
+    _sessionCacheSize(0),
+    _sessionHits(0),
+    _sessionMisses(0)
 {
     __setNoDelete(true);
 
@@ -809,22 +825,102 @@ OpenSSL::SSLEngine::initialize()
         //
         SSL_CTX_set_ex_data(_ctx, 0, this);
 
-        //
-        // This is necessary for successful interop with Java. Without it, a Java
-        // client would fail to reestablish a connection: the server gets the
-        // error "session id context uninitialized" and the client receives
-        // "SSLHandshakeException: Remote host closed connection during handshake".
-        //
-        SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_OFF);
+        _sessionCache = properties->getPropertyAsInt(propPrefix + "SessionCache") > 0;
+        if(_sessionCache)
+        {
+            //
+            // The sessions of incoming connections are cached by the context,
+            // the sessions of outgoing connections are handed to newSession
+            // and cached per endpoint.
+            //
+            SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_BOTH);
+            SSL_CTX_sess_set_new_cb(_ctx, IceSSL_opensslNewSessionCallback);
+
+            int size = properties->getPropertyAsIntWithDefault(propPrefix + "SessionCacheSize", 1024);
+            if(size < 1)
+            {
+                Warning out(getLogger());
+                out << "IceSSL: invalid value for " << propPrefix << "SessionCacheSize: " << size
+                    << ", adjusted to 1024";
+                size = 1024;
+            }
+            _sessionCacheSize = static_cast<size_t>(size);
+            SSL_CTX_sess_set_cache_size(_ctx, size);
+
+            int timeout = properties->getPropertyAsInt(propPrefix + "SessionTimeout");
+            if(timeout > 0)
+            {
+                SSL_CTX_set_timeout(_ctx, timeout);
+            }
+
+            //
+            // Use the same session ticket keys across restarts of the server,
+            // otherwise the tickets issued before a restart can't be used to
+            // resume sessions.
+            //
+            string file = properties->getProperty(propPrefix + "SessionTicketKeys");
+            if(!file.empty())
+            {
+                string resolved;
+                if(!checkPath(file, properties->getProperty(propPrefix + "DefaultDir"), false, resolved))
+                {
+                    throw PluginInitializationException(__FILE__, __LINE__,
+                                                        "IceSSL: session ticket keys file not found:\n" + file);
+                }
+                //
+                // The size of the keys depends on the OpenSSL version (48 bytes
+                // with OpenSSL 1.0.x and 80 bytes since 1.1.0), it's returned
+                // when no keys are given.
+                //
+                long size = SSL_CTX_set_tlsext_ticket_keys(_ctx, 0, 0);
+                vector<char> keys;
+                readFile(resolved, keys);
+                if(static_cast<long>(keys.size()) != size ||
+                   SSL_CTX_set_tlsext_ticket_keys(_ctx, &keys[0], size) <= 0)
+                {
+                    ostringstream os;
+                    os << "IceSSL: unable to set session ticket keys from " << resolved
+                       << ":\nthe file must contain " << size << " bytes\n" << sslErrors();
+                    throw PluginInitializationException(__FILE__, __LINE__, os.str());
+                }
+            }
+        }
+        else
+        {
+            //
+            // This is necessary for successful interop with Java. Without it, a Java
+            // client would fail to reestablish a connection: the server gets the
+            // error "session id context uninitialized" and the client receives
+            // "SSLHandshakeException: Remote host closed connection during handshake".
+            //
+            SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_OFF);
+        }
 
         //
-        // Although we disable session caching, we still need to set a session ID
-        // context (ICE-5103). The value can be anything; here we just use the
-        // pointer to this SharedInstance object.
+        // Although we disable session caching by default, we still need to set a
+        // session ID context (ICE-5103). The value can be anything; here we just
+        // use the pointer to this SharedInstance object. With session caching, the
+        // context of incoming connections is set per object adapter.
         //
         SSL_CTX_set_session_id_context(_ctx, reinterpret_cast<unsigned char*>(this),
                                         static_cast<unsigned int>(sizeof(this)));
 
+        //
+        // With kernel TLS, OpenSSL hands the negotiated keys to the kernel
+        // once the handshake completes and the records are encrypted and
+        // decrypted by the socket layer. OpenSSL silently keeps using its own
+        // record layer if the kernel or the negotiated cipher don't support it.
+        //
+        if(properties->getPropertyAsInt(propPrefix + "KernelTLS") > 0)
+        {
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+            SSL_CTX_set_options(_ctx, SSL_OP_ENABLE_KTLS);
+#else
+            Warning out(getLogger());
+            out << "IceSSL: " << propPrefix << "KernelTLS is not supported with this OpenSSL version";
+#endif
+        }
+
         //
         // Select protocols.
         //
@@ -905,12 +1001,114 @@ OpenSSL::SSLEngine::sslErrors() const
 void
 OpenSSL::SSLEngine::destroy()
 {
+    clearSessions();
     if(_ctx)
     {
         SSL_CTX_free(_ctx);
     }
 }
 
+bool
+OpenSSL::SSLEngine::sessionCache() const
+{
+    return _sessionCache;
+}
+
+void
+OpenSSL::SSLEngine::setSession(SSL* ssl, const string& key)
+{
+    IceUtil::Mutex::Lock sync(_sessionMutex);
+    map<string, SSL_SESSION*>::const_iterator p = _sessions.find(key);
+    if(p != _sessions.end())
+    {
+        SSL_set_session(ssl, p->second); // Adds a reference to the session.
+    }
+}
+
+int
+OpenSSL::SSLEngine::newSession(SSL* ssl, SSL_SESSION* session)
+{
+    TransceiverI* transceiver = reinterpret_cast<TransceiverI*>(SSL_get_ex_data(ssl, 0));
+    if(!transceiver || transceiver->_incoming)
+    {
+        return 0; // Sessions of incoming connections are cached by the context.
+    }
+
+#if OPENSSL_VERSION_NUMBER >= 0x10101000L && !defined(LIBRESSL_VERSION_NUMBER)
+    if(!SSL_SESSION_is_resumable(session))
+    {
+        return 0;
+    }
+#endif
+
+    IceUtil::Mutex::Lock sync(_sessionMutex);
+    map<string, SSL_SESSION*>::iterator p = _sessions.find(transceiver->_sessionKey);
+    if(p != _sessions.end())
+    {
+        SSL_SESSION_free(p->second);
+        p->second = session;
+        return 1; // We keep the reference on the session.
+    }
+
+    if(_sessions.size() >= _sessionCacheSize)
+    {
+        //
+        // Evict the oldest session.
+        //
+        map<string, SSL_SESSION*>::iterator oldest = _sessions.begin();
+        for(map<string, SSL_SESSION*>::iterator q = _sessions.begin(); q != _sessions.end(); ++q)
+        {
+            if(SSL_SESSION_get_time(q->second) < SSL_SESSION_get_time(oldest->second))
+            {
+                oldest = q;
+            }
+        }
+        SSL_SESSION_free(oldest->second);
+        _sessions.erase(oldest);
+    }
+    _sessions.insert(make_pair(transceiver->_sessionKey, session));
+    return 1;
+}
+
+void
+OpenSSL::SSLEngine::sessionEstablished(bool reused)
+{
+    IceUtil::Mutex::Lock sync(_sessionMutex);
+    if(reused)
+    {
+        ++_sessionHits;
+    }
+    else
+    {
+        ++_sessionMisses;
+    }
+}
+
+Ice::Long
+OpenSSL::SSLEngine::sessionCacheHits() const
+{
+    IceUtil::Mutex::Lock sync(_sessionMutex);
+    return _sessionHits;
+}
+
+Ice::Long
+OpenSSL::SSLEngine::sessionCacheMisses() const
+{
+    IceUtil::Mutex::Lock sync(_sessionMutex);
+    return _sessionMisses;
+}
+
+void
+OpenSSL::SSLEngine::clearSessions()
+{
+    IceUtil::Mutex::Lock sync(_sessionMutex);
+    for(map<string, SSL_SESSION*>::const_iterator p = _sessions.begin(); p != _sessions.end(); ++p)
+    {
+        SSL_SESSION_free(p->second);
+    }
+    _sessions.clear();
+}
+
 void
 OpenSSL::SSLEngine::verifyPeer(const string& address, const IceSSL::ConnectionInfoPtr& info, const string& desc)
 {
@@ -16,6 +16,8 @@
 
 #include <Ice/BuiltinSequences.h>
 
+#include <map>
+
 namespace IceSSL
 {
 
@@ -43,6 +45,18 @@ public:
     void context(SSL_CTX*);
     std::string sslErrors() const;
 
+    //
+    // Session caching, see IceSSL.SessionCache. The sessions of outgoing
+    // connections are kept per endpoint and set on the new connections to
+    // the same endpoint.
+    //
+    bool sessionCache() const;
+    void setSession(SSL*, const std::string&);
+    int newSession(SSL*, SSL_SESSION*);
+    void sessionEstablished(bool);
+    Ice::Long sessionCacheHits() const;
+    Ice::Long sessionCacheMisses() const;
+
 private:
 
     SSL_METHOD* getMethod(int);
@@ -50,8 +64,17 @@ private:
     enum Protocols { SSLv3 = 0x01, TLSv1_0 = 0x02, TLSv1_1 = 0x04, TLSv1_2 = 0x08 };
     int parseProtocols(const Ice::StringSeq&) const;
 
+    void clearSessions();
+
     SSL_CTX* _ctx;
 
+    bool _sessionCache;
+    size_t _sessionCacheSize;
+    mutable IceUtil::Mutex _sessionMutex;
+    std::map<std::string, SSL_SESSION*> _sessions;
+    Ice::Long _sessionHits;
+    Ice::Long _sessionMisses;
+
 #ifndef OPENSSL_NO_DH
     IceSSL::OpenSSL::DHParamsPtr _dhParams;
 #endif
@@ -19,7 +19,8 @@ namespace
 {
 
 class PluginI : public IceSSL::PluginI,
-                public IceSSL::OpenSSL::Plugin
+                public IceSSL::OpenSSL::Plugin,
+                public IceSSL::OpenSSL::SessionCacheStats
 {
 public:
 
@@ -31,10 +32,17 @@ public:
     virtual IceSSL::CertificatePtr decode(const std::string&) const;
     virtual void setContext(SSL_CTX*);
     virtual SSL_CTX* getContext();
+    virtual Ice::Long getSessionCacheHits() const;
+    virtual Ice::Long getSessionCacheMisses() const;
 };
 
 } // anonymous namespace end
 
+IceSSL::OpenSSL::SessionCacheStats::~SessionCacheStats()
+{
+    // Out of line to avoid weak vtable
+}
+
 //
 // Plugin implementation.
 //
@@ -83,6 +91,22 @@ PluginI::getContext()
     return engine->context();
 }
 
+Ice::Long
+PluginI::getSessionCacheHits() const
+{
+    IceSSL::OpenSSL::SSLEngine* engine = dynamic_cast<IceSSL::OpenSSL::SSLEngine*>(_engine.get());
+    assert(engine);
+    return engine->sessionCacheHits();
+}
+
+Ice::Long
+PluginI::getSessionCacheMisses() const
+{
+    IceSSL::OpenSSL::SSLEngine* engine = dynamic_cast<IceSSL::OpenSSL::SSLEngine*>(_engine.get());
+    assert(engine);
+    return engine->sessionCacheMisses();
+}
+
 #ifdef _WIN32
 //
 // Plug-in factory function.
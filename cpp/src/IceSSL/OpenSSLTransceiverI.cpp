@@ -22,6 +22,7 @@
 #include <Ice/Buffer.h>
 #include <Ice/LocalException.h>
 #include <Ice/Network.h>
+#include <Ice/SHA1.h>
 
 #include <openssl/ssl.h>
 #include <openssl/err.h>
@@ -189,6 +190,34 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
 
             SSL_set_verify(_ssl, sslVerifyMode, IceSSL_opensslVerifyCallback);
         }
+
+        if(_engine->sessionCache())
+        {
+            if(_incoming)
+            {
+                //
+                // Sessions are only resumed with the object adapter which
+                // established them.
+                //
+                vector<unsigned char> context;
+                IceInternal::sha1(reinterpret_cast<const unsigned char*>(_adapterName.c_str()), _adapterName.size(),
+                                  context);
+                SSL_set_session_id_context(_ssl, &context[0], static_cast<unsigned int>(context.size()));
+            }
+            else
+            {
+                //
+                // Sessions are cached per server, a session is offered to the
+                // server if one was established with it previously.
+                //
+                IceInternal::Address remoteAddr;
+                if(IceInternal::fdToRemoteAddress(fd, remoteAddr))
+                {
+                    _sessionKey = _host + "/" + IceInternal::addrToString(remoteAddr);
+                    _engine->setSession(_ssl, _sessionKey);
+                }
+            }
+        }
     }
 
     while(!SSL_is_init_finished(_ssl))
@@ -326,6 +355,50 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
         _verified = true;
     }
 
+    if(_engine->sessionCache())
+    {
+        bool resumed = SSL_session_reused(_ssl) != 0;
+        if(resumed && _certs.empty())
+        {
+            //
+            // The verify callback isn't called for resumed sessions. Rebuild the
+            // chain from the certificates sent by the peer when the session was
+            // established, verifyPeer and IceSSL.TrustOnly check it below.
+            //
+            X509* peer = SSL_get_peer_certificate(_ssl);
+            if(peer)
+            {
+                X509_STORE_CTX* ctx = X509_STORE_CTX_new();
+                if(ctx && X509_STORE_CTX_init(ctx, SSL_CTX_get_cert_store(SSL_get_SSL_CTX(_ssl)), peer,
+                                              SSL_get_peer_cert_chain(_ssl)))
+                {
+                    //
+                    // The verification result was saved with the session, we
+                    // only need the chain.
+                    //
+                    X509_verify_cert(ctx);
+                    STACK_OF(X509)* chain = X509_STORE_CTX_get1_chain(ctx);
+                    if(chain != 0)
+                    {
+                        for(int i = 0; i < sk_X509_num(chain); ++i)
+                        {
+                            _certs.push_back(OpenSSL::Certificate::create(X509_dup(sk_X509_value(chain, i))));
+                        }
+                        sk_X509_pop_free(chain, X509_free);
+                    }
+                }
+                X509_STORE_CTX_free(ctx);
+
+                if(_certs.empty())
+                {
+                    _certs.push_back(OpenSSL::Certificate::create(X509_dup(peer)));
+                }
+                X509_free(peer);
+            }
+        }
+        _engine->sessionEstablished(resumed);
+    }
+
     _cipher = SSL_get_cipher_name(_ssl); // Nothing needs to be free'd.
     _engine->verifyPeer(_host, ICE_DYNAMIC_CAST(ConnectionInfo, getInfo()), toString());
 
@@ -349,6 +422,18 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
             out << "bits = " << SSL_CIPHER_get_bits(cipher, 0) << "\n";
             out << "protocol = " << SSL_get_version(_ssl) << "\n";
         }
+        if(_engine->sessionCache())
+        {
+            out << "session = " << (SSL_session_reused(_ssl) ? "resumed" : "new") << "\n";
+        }
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+        if(SSL_get_options(_ssl) & SSL_OP_ENABLE_KTLS)
+        {
+            bool kernelRecv = BIO_get_ktls_recv(SSL_get_rbio(_ssl)) != 0;
+            out << "kernel TLS = " << (kernelSend() ? (kernelRecv ? "send, receive" : "send") :
+                                                     (kernelRecv ? "receive" : "none")) << "\n";
+        }
+#endif
         out << IceInternal::fdToString(SSL_get_fd(_ssl));
     }
 
@@ -416,6 +501,13 @@ OpenSSL::TransceiverI::write(IceInternal::Buffer& buf)
         return IceInternal::SocketOperationNone;
     }
 
+#ifndef ICE_USE_IOCP
+    if(kernelWrite())
+    {
+        return _delegate->write(buf);
+    }
+#endif
+
     //
     // It's impossible for packetSize to be more than an Int.
     //
@@ -473,6 +565,8 @@ OpenSSL::TransceiverI::write(IceInternal::Buffer& buf)
                 {
                     continue;
                 }
+#else
+                _writePending = true;
 #endif
                 return IceInternal::SocketOperationWrite;
             }
@@ -494,6 +588,7 @@ OpenSSL::TransceiverI::write(IceInternal::Buffer& buf)
                 if(IceInternal::wouldBlock())
                 {
                     assert(SSL_want_write(_ssl));
+                    _writePending = true;
                     return IceInternal::SocketOperationWrite;
                 }
 #endif
@@ -521,6 +616,7 @@ OpenSSL::TransceiverI::write(IceInternal::Buffer& buf)
             packetSize = static_cast<int>(buf.b.end() - buf.i);
         }
     }
+    _writePending = false;
     return IceInternal::SocketOperationNone;
 }
 
@@ -775,6 +871,57 @@ OpenSSL::TransceiverI::finishRead(IceInternal::Buffer& buffer)
         buffer.i += ret;
     }
 }
+#else
+bool
+OpenSSL::TransceiverI::supportsWritev() const
+{
+    return kernelSend() && _delegate->supportsWritev();
+}
+
+IceInternal::SocketOperation
+OpenSSL::TransceiverI::writev(const vector<IceInternal::Buffer*>& buffers)
+{
+    if(kernelWrite())
+    {
+        return _delegate->writev(buffers);
+    }
+    return Transceiver::writev(buffers);
+}
+
+bool
+OpenSSL::TransceiverI::kernelSend() const
+{
+    //
+    // If OpenSSL handed the keys to the kernel, the socket encrypts the
+    // data written to it. This is checked for each write rather than once
+    // after the handshake, OpenSSL decides again whether the kernel is
+    // used each time the keys change.
+    //
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+    return _ssl && BIO_get_ktls_send(SSL_get_wbio(_ssl)) != 0;
+#else
+    return false;
+#endif
+}
+
+bool
+OpenSSL::TransceiverI::kernelWrite() const
+{
+    //
+    // With kernel TLS, the data is written directly to the socket unless
+    // OpenSSL has data of its own to send first: the remainder of a
+    // partially written record or a pending TLS 1.3 key update.
+    //
+    if(_writePending || !kernelSend())
+    {
+        return false;
+    }
+#if OPENSSL_VERSION_NUMBER >= 0x10101000L && !defined(LIBRESSL_VERSION_NUMBER)
+    return SSL_get_key_update_type(_ssl) == SSL_KEY_UPDATE_NONE;
+#else
+    return true;
+#endif
+}
 #endif
 
 string
@@ -877,6 +1024,7 @@ OpenSSL::TransceiverI::TransceiverI(const InstancePtr& instance,
     _delegate(delegate),
     _connected(false),
     _verified(false),
+    _writePending(false),
     _ssl(0)
 #ifdef ICE_USE_IOCP
     , _iocpBio(0),
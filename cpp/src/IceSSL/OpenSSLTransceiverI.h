@@ -46,6 +46,9 @@ public:
     virtual void finishWrite(IceInternal::Buffer&);
     virtual void startRead(IceInternal::Buffer&);
     virtual void finishRead(IceInternal::Buffer&);
+#else
+    virtual bool supportsWritev() const;
+    virtual IceInternal::SocketOperation writev(const std::vector<IceInternal::Buffer*>&);
 #endif
     virtual std::string protocol() const;
     virtual std::string toString() const;
@@ -64,6 +67,9 @@ private:
 #ifdef ICE_USE_IOCP
     bool receive();
     bool send();
+#else
+    bool kernelSend() const;
+    bool kernelWrite() const;
 #endif
 
     friend class IceSSL::OpenSSL::SSLEngine;
@@ -78,6 +84,8 @@ private:
     std::string _cipher;
     std::vector<IceSSL::CertificatePtr> _certs;
     bool _verified;
+    std::string _sessionKey;
+    bool _writePending;
 
     SSL* _ssl;
 #ifdef ICE_USE_IOCP
@@ -378,6 +378,178 @@ condMove(bool moveIt, const string& str)
     return moveIt ? string("::std::move(") + str + ")" : str;
 }
 
+//
+// Returns the DirectInvocationT type used to pass the parameters of the
+// C++11 operation directly to a collocated servant, or an empty string if
+// the operation can't be invoked this way. The proxy references its
+// in-parameters and the skeleton writes the results in place, this
+// requires the proxy, servant and result types to match. Operations with
+// classes are always marshaled since class instances are shared.
+//
+string
+directInvocationType(const OperationPtr& p, int typeCtx)
+{
+    if(p->sendsClasses(false) || p->returnsClasses(false))
+    {
+        return "";
+    }
+
+    ClassDefPtr cl = ClassDefPtr::dynamicCast(p->container());
+    string clScope = fixKwd(cl->scope());
+
+    vector<string> inTypes;
+    vector<string> outTypes;
+
+    TypePtr ret = p->returnType();
+    if(ret)
+    {
+        string typeS = typeToString(ret, p->returnIsOptional(), clScope, p->getMetaData(), typeCtx);
+        if(returnTypeToString(ret, p->returnIsOptional(), clScope, p->getMetaData(), typeCtx) != typeS)
+        {
+            return "";
+        }
+        outTypes.push_back(typeS);
+    }
+
+    ParamDeclList paramList = p->parameters();
+    for(ParamDeclList::const_iterator q = paramList.begin(); q != paramList.end(); ++q)
+    {
+        StringList metaData = (*q)->getMetaData();
+        if((*q)->isOutParam())
+        {
+            string typeS = typeToString((*q)->type(), (*q)->optional(), clScope, metaData, typeCtx);
+            if(outputTypeToString((*q)->type(), (*q)->optional(), clScope, metaData, typeCtx) != typeS + "&")
+            {
+                return "";
+            }
+            outTypes.push_back(typeS);
+        }
+        else
+        {
+            string typeS = typeToString((*q)->type(), (*q)->optional(), clScope, metaData,
+                                        typeCtx | TypeContextInParam);
+            string inputTypeS = inputTypeToString((*q)->type(), (*q)->optional(), clScope, metaData, typeCtx);
+            if(inputTypeS != typeS && inputTypeS != "const " + typeS + "&")
+            {
+                return "";
+            }
+            inTypes.push_back(typeS);
+        }
+    }
+
+    if(inTypes.empty() && outTypes.empty())
+    {
+        return "";
+    }
+
+    string resultT;
+    if(outTypes.empty())
+    {
+        resultT = "void";
+    }
+    else if(outTypes.size() == 1)
+    {
+        resultT = outTypes.front();
+    }
+    else
+    {
+        resultT = resultStructName(p->name(), fixKwd(cl->name()));
+    }
+
+    string directT = "::IceInternal::DirectInvocationT<" + resultT;
+    for(vector<string>::const_iterator q = inTypes.begin(); q != inTypes.end(); ++q)
+    {
+        directT += ", " + *q;
+    }
+    return directT + ">";
+}
+
+void
+writeIndexCases(IceUtilInternal::Output& C, const vector<pair<string, int> >& strings, const string& arrayName)
+{
+    if(strings.size() == 1)
+    {
+        C << nl << "if(s == " << arrayName << '[' << strings.front().second << "])";
+        C << sb;
+        C << nl << "return " << strings.front().second << ';';
+        C << eb;
+        return;
+    }
+
+    //
+    // The strings have the same length, switch on the character which
+    // tells apart the most of them.
+    //
+    string::size_type pos = 0;
+    size_t maxDistinct = 0;
+    for(string::size_type i = 0; i < strings.front().first.size(); ++i)
+    {
+        set<char> chars;
+        for(vector<pair<string, int> >::const_iterator q = strings.begin(); q != strings.end(); ++q)
+        {
+            chars.insert(q->first[i]);
+        }
+        if(chars.size() > maxDistinct)
+        {
+            maxDistinct = chars.size();
+            pos = i;
+        }
+    }
+
+    map<char, vector<pair<string, int> > > byChar;
+    for(vector<pair<string, int> >::const_iterator q = strings.begin(); q != strings.end(); ++q)
+    {
+        byChar[q->first[pos]].push_back(*q);
+    }
+
+    C << nl << "switch(s[" << pos << "])";
+    C << sb;
+    for(map<char, vector<pair<string, int> > >::const_iterator q = byChar.begin(); q != byChar.end(); ++q)
+    {
+        C << nl << "case '" << q->first << "':";
+        C << sb;
+        writeIndexCases(C, q->second, arrayName);
+        C << nl << "break;";
+        C << eb;
+    }
+    C << eb;
+}
+
+//
+// Writes a function which returns the position of a string in the given
+// sorted array, or -1 if it's not there. The generated code switches on
+// the length of the string and then on its characters until a single
+// candidate is left, so a lookup does at most one string comparison
+// instead of the comparisons of a binary search.
+//
+void
+writeIndexFunction(IceUtilInternal::Output& C, const string& name, const StringList& strings, const string& arrayName)
+{
+    map<string::size_type, vector<pair<string, int> > > bySize;
+    int i = 0;
+    for(StringList::const_iterator q = strings.begin(); q != strings.end(); ++q)
+    {
+        bySize[q->size()].push_back(make_pair(*q, i++));
+    }
+
+    C << sp << nl << "int";
+    C << nl << name << "(const ::std::string& s)";
+    C << sb;
+    C << nl << "switch(s.size())";
+    C << sb;
+    for(map<string::size_type, vector<pair<string, int> > >::const_iterator q = bySize.begin(); q != bySize.end(); ++q)
+    {
+        C << nl << "case " << q->first << ':';
+        C << sb;
+        writeIndexCases(C, q->second, arrayName);
+        C << nl << "break;";
+        C << eb;
+    }
+    C << eb;
+    C << nl << "return -1;";
+    C << eb;
+}
+
 }
 
 Slice::Gen::Gen(const string& base, const string& headerExtension, const string& sourceExtension,
@@ -2528,13 +2700,14 @@ Slice::Gen::ObjectVisitor::visitClassDefStart(const ClassDefPtr& p)
             }
         }
         C << eb << ';';
+        writeIndexFunction(C, flatName + "Index", ids, flatName);
         C << sp << nl << "}";
 
         C << sp;
         C << nl << "bool" << nl << scoped.substr(2)
           << "::ice_isA(const ::std::string& s, const " << getAbsolute("::Ice::Current&", scope) << ") const";
         C << sb;
-        C << nl << "return ::std::binary_search(" << flatName << ", " << flatName << " + " << ids.size() << ", s);";
+        C << nl << "return " << flatName << "Index(s) >= 0;";
         C << eb;
 
         C << sp;
@@ -2633,23 +2806,14 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
                 }
             }
             C << eb << ';';
+            writeIndexFunction(C, flatName + "Index", allOpNames, flatName);
             C << sp << nl << "}";
             C << sp;
             C << nl << "bool";
             C << nl << scoped.substr(2) << "::_iceDispatch(::IceInternal::Incoming& in, const "
               << getAbsolute("::Ice::Current&", scope) << " current)";
             C << sb;
-
-            C << nl << "::std::pair<const ::std::string*, const ::std::string*> r = "
-              << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
-              << ", current.operation);";
-            C << nl << "if(r.first == r.second)";
-            C << sb;
-            C << nl << "throw " << getAbsolute("::Ice::OperationNotExistException", scope)
-              << "(__FILE__, __LINE__, current.id, " << "current.facet, current.operation);";
-            C << eb;
-            C << sp;
-            C << nl << "switch(r.first - " << flatName << ')';
+            C << nl << "switch(" << flatName << "Index(current.operation))";
             C << sb;
             int i = 0;
             for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
@@ -2661,7 +2825,6 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
             }
             C << nl << "default:";
             C << sb;
-            C << nl << "assert(false);";
             C << nl << "throw " << getAbsolute("::Ice::OperationNotExistException", scope)
               << "(__FILE__, __LINE__, current.id, " << "current.facet, current.operation);";
             C << eb;
@@ -2721,15 +2884,13 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
                   << "::ice_operationAttributes(const ::std::string& opName) const";
                 C << sb;
 
-                C << nl << "::std::pair<const ::std::string*, const ::std::string*> r = "
-                  << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
-                  << ", opName);";
-                C << nl << "if(r.first == r.second)";
+                C << nl << "int i = " << flatName << "Index(opName);";
+                C << nl << "if(i < 0)";
                 C << sb;
                 C << nl << "return -1;";
                 C << eb;
 
-                C << nl << "return " << opAttrFlatName << "[r.first - " << flatName << "];";
+                C << nl << "return " << opAttrFlatName << "[i];";
                 C << eb;
             }
         }
@@ -5338,6 +5499,8 @@ Slice::Gen::Cpp11DeclVisitor::visitClassDefStart(const ClassDefPtr& p)
             }
         }
         C << eb << ';';
+        writeIndexFunction(C, "iceC" + p->flattenedScope() + p->name() + "_idsIndex", ids,
+                           "iceC" + p->flattenedScope() + p->name() + "_ids");
 
         StringList allOpNames;
         transform(allOps.begin(), allOps.end(), back_inserter(allOpNames), ::IceUtil::constMemFun(&Contained::name));
@@ -5359,6 +5522,15 @@ Slice::Gen::Cpp11DeclVisitor::visitClassDefStart(const ClassDefPtr& p)
             }
         }
         C << eb << ';';
+
+        //
+        // _iceDispatch is only generated for classes with operations.
+        //
+        if(!allOps.empty())
+        {
+            writeIndexFunction(C, "iceC" + p->flattenedScope() + p->name() + "_opsIndex", allOpNames,
+                               "iceC" + p->flattenedScope() + p->name() + "_ops");
+        }
     }
 
     return true;
@@ -6294,6 +6466,21 @@ Slice::Gen::Cpp11ProxyVisitor::visitOperation(const OperationPtr& p)
     {
         C << nl << "_checkTwowayOnly(" << flatName << ");";
     }
+    string directT = directInvocationType(p, _useWstring | TypeContextCpp11);
+    if(!directT.empty())
+    {
+        C << nl << directT << " direct";
+        if(!inParams.empty())
+        {
+            C << spar;
+            for(ParamDeclList::const_iterator q = inParams.begin(); q != inParams.end(); ++q)
+            {
+                C << fixKwd(paramPrefix + (*q)->name());
+            }
+            C << epar;
+        }
+        C << ";";
+    }
     C << nl << "outAsync->invoke(" << flatName << ", ";
     C << getAbsolute(operationModeToString(p->sendMode(), true), clScope) << ", "
       << getAbsolute(opFormatTypeToString(p, true), clScope) << ", context,";
@@ -6352,6 +6539,11 @@ Slice::Gen::Cpp11ProxyVisitor::visitOperation(const OperationPtr& p)
         C << eb;
     }
 
+    if(!directT.empty())
+    {
+        C << "," << nl << "&direct";
+    }
+
     C.dec();
     C << ");" << eb;
 }
@@ -7010,7 +7202,7 @@ Slice::Gen::Cpp11InterfaceVisitor::visitClassDefStart(const ClassDefPtr& p)
     C << nl << "bool" << nl << scoped.substr(2) << "::ice_isA(::std::string s, const "
       << getAbsolute("::Ice::Current&", scope) << ") const";
     C << sb;
-    C << nl << "return ::std::binary_search(" << flatName << ", " << flatName << " + " << ids.size() << ", s);";
+    C << nl << "return " << flatName << "Index(s) >= 0;";
     C << eb;
 
     C << sp;
@@ -7078,15 +7270,7 @@ Slice::Gen::Cpp11InterfaceVisitor::visitClassDefEnd(const ClassDefPtr& p)
           << getAbsolute("::Ice::Current&", scope) << " current)";
         C << sb;
 
-        C << nl << "::std::pair<const ::std::string*, const ::std::string*> r = "
-          << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size() << ", current.operation);";
-        C << nl << "if(r.first == r.second)";
-        C << sb;
-        C << nl << "throw " << getAbsolute("::Ice::OperationNotExistException", scope)
-          << "(__FILE__, __LINE__, current.id, current.facet, current.operation);";
-        C << eb;
-        C << sp;
-        C << nl << "switch(r.first - " << flatName << ')';
+        C << nl << "switch(" << flatName << "Index(current.operation))";
         C << sb;
         int i = 0;
         for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
@@ -7098,7 +7282,6 @@ Slice::Gen::Cpp11InterfaceVisitor::visitClassDefEnd(const ClassDefPtr& p)
         }
         C << nl << "default:";
         C << sb;
-        C << nl << "assert(false);";
         C << nl << "throw " << getAbsolute("::Ice::OperationNotExistException", scope)
           << "(__FILE__, __LINE__, current.id, current.facet, current.operation);";
         C << eb;
@@ -7272,6 +7455,49 @@ Slice::Gen::Cpp11InterfaceVisitor::visitOperation(const OperationPtr& p)
     C << sb;
     C << nl << "_iceCheckMode(" << getAbsolute(operationModeToString(p->mode(), true), classScope) << ", current.mode);";
 
+    string directT = amd || p->hasMarshaledResult() ? string() : directInvocationType(p, _useWstring | TypeContextCpp11);
+    if(!directT.empty())
+    {
+        //
+        // Collocated direct invocation, the servant gets copies of the in-parameters
+        // and its results are written in the invocation.
+        //
+        vector<string> directArgs;
+        string directRet;
+        int pos = 0;
+        bool multipleOut = (ret ? 1 : 0) + outParams.size() > 1;
+        string returnValueS = "returnValue";
+        for(ParamDeclList::const_iterator q = paramList.begin(); q != paramList.end(); ++q)
+        {
+            if((*q)->isOutParam())
+            {
+                if((*q)->name() == "returnValue")
+                {
+                    returnValueS = "_returnValue";
+                }
+                directArgs.push_back(multipleOut ? "direct->result." + fixKwd((*q)->name()) : "direct->result");
+            }
+            else
+            {
+                ostringstream os;
+                os << "::std::get<" << pos++ << ">(direct->params)";
+                directArgs.push_back(os.str());
+            }
+        }
+        directArgs.push_back("current");
+        if(ret)
+        {
+            directRet = multipleOut ? "direct->result." + returnValueS + " = " : "direct->result = ";
+        }
+
+        C << nl << "if(auto direct = dynamic_cast<" << directT << "*>(inS.startDirectParams()))";
+        C << sb;
+        C << nl << directRet << "this->" << opName << spar << directArgs << epar << ';';
+        C << nl << "inS.endDirectParams();";
+        C << nl << "return true;";
+        C << eb;
+    }
+
     if(!inParams.empty())
     {
         C << nl << "auto istr = inS.startReadParams();";
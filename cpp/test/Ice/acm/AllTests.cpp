@@ -402,6 +402,36 @@ public:
     }
 };
 
+class InvocationHeartbeatOnDispatchCloseOnIdleTest : public TestCase
+{
+public:
+
+    InvocationHeartbeatOnDispatchCloseOnIdleTest(const RemoteCommunicatorPrxPtr& com) :
+        TestCase("invocation with heartbeat on dispatch and close on idle", com)
+    {
+        setClientACM(3, 3, 0); // Close on invocation and idle, no heartbeat.
+        setServerACM(4, 1, 1); // Only close on idle, heartbeat on dispatch.
+    }
+
+    virtual void runTestCase(const RemoteObjectAdapterPrxPtr& adapter, const TestIntfPrxPtr& proxy)
+    {
+        // Keep the connection active without dispatching for longer than
+        // (timeout / 2): the server then only monitors the connection for
+        // the idle timeout. It must still send heartbeats as soon as the
+        // long dispatch starts for the client not to close the connection.
+        for(int i = 0; i < 10; ++i)
+        {
+            proxy->ice_ping();
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(250));
+        }
+        proxy->sleep(4);
+
+        Lock sync(*this);
+        test(_heartbeat >= 2);
+        test(!_closed);
+    }
+};
+
 class CloseOnIdleTest : public TestCase
 {
 public:
@@ -707,6 +737,7 @@ allTests(const Ice::CommunicatorPtr& communicator)
     tests.push_back(ICE_MAKE_SHARED(InvocationHeartbeatOnHoldTest, com));
     tests.push_back(ICE_MAKE_SHARED(InvocationNoHeartbeatTest, com));
     tests.push_back(ICE_MAKE_SHARED(InvocationHeartbeatCloseOnIdleTest, com));
+    tests.push_back(ICE_MAKE_SHARED(InvocationHeartbeatOnDispatchCloseOnIdleTest, com));
 
     tests.push_back(ICE_MAKE_SHARED(CloseOnIdleTest, com));
     tests.push_back(ICE_MAKE_SHARED(CloseOnInvocationTest, com));
@@ -0,0 +1,460 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <Test.h>
+
+#include <fstream>
+#include <iomanip>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+
+//
+// The result of a single benchmark run. Latencies are only collected
+// for benchmarks which time each invocation individually.
+//
+struct Result
+{
+    Result(const string& n) : name(n), count(0), bytes(0)
+    {
+    }
+
+    string name;
+    int count;
+    Ice::Long bytes;
+    IceUtil::Time elapsed;
+    vector<Ice::Long> latencies; // In microseconds.
+};
+
+Ice::Long
+percentile(const vector<Ice::Long>& sorted, double p)
+{
+    assert(!sorted.empty());
+    size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size()));
+    return sorted[min(index, sorted.size() - 1)];
+}
+
+//
+// Prints the results on the console and, if Benchmark.Output is set,
+// appends one JSON object per line to the given file so that results
+// can be collected and compared across runs.
+//
+class Reporter
+{
+public:
+
+    Reporter(const Ice::CommunicatorPtr& communicator, bool collocated) :
+        _transport(collocated ? string("collocated") : getTestProtocol(communicator->getProperties())),
+#ifdef ICE_CPP11_MAPPING
+        _mapping("cpp11")
+#else
+        _mapping("cpp98")
+#endif
+    {
+        string file = communicator->getProperties()->getProperty("Benchmark.Output");
+        if(!file.empty())
+        {
+            _out.open(file.c_str(), ios::out | ios::app);
+            test(_out.good());
+        }
+    }
+
+    void
+    report(Result& r)
+    {
+        double seconds = r.elapsed.toSecondsDouble();
+        double callsPerSecond = seconds > 0 ? r.count / seconds : 0;
+        double megabytesPerSecond = seconds > 0 ? static_cast<double>(r.bytes) / (1024.0 * 1024.0) / seconds : 0;
+
+        ostringstream os;
+        os << fixed << setprecision(2);
+        os << "\"benchmark\":\"" << r.name << "\",\"transport\":\"" << _transport << "\",\"mapping\":\""
+           << _mapping << "\",\"count\":" << r.count << ",\"seconds\":" << seconds << ",\"callsPerSecond\":"
+           << callsPerSecond;
+        if(r.bytes > 0)
+        {
+            os << ",\"bytes\":" << r.bytes << ",\"megabytesPerSecond\":" << megabytesPerSecond;
+        }
+
+        cout << "ok (" << fixed << setprecision(2) << callsPerSecond << " calls/s";
+        if(r.bytes > 0)
+        {
+            cout << ", " << megabytesPerSecond << " MB/s";
+        }
+
+        if(!r.latencies.empty())
+        {
+            sort(r.latencies.begin(), r.latencies.end());
+            Ice::Long p50 = percentile(r.latencies, 0.50);
+            Ice::Long p90 = percentile(r.latencies, 0.90);
+            Ice::Long p99 = percentile(r.latencies, 0.99);
+            Ice::Long p999 = percentile(r.latencies, 0.999);
+            Ice::Long max = r.latencies.back();
+            os << ",\"p50\":" << p50 << ",\"p90\":" << p90 << ",\"p99\":" << p99 << ",\"p999\":" << p999
+               << ",\"max\":" << max;
+            cout << ", p50=" << p50 << "us p99=" << p99 << "us max=" << max << "us";
+        }
+        cout << ")" << endl;
+
+        if(_out.is_open())
+        {
+            _out << "{" << os.str() << "}" << endl;
+        }
+    }
+
+private:
+
+    const string _transport;
+    const string _mapping;
+    ofstream _out;
+};
+
+//
+// Limits the number of outstanding AMI invocations to the pipeline
+// depth.
+//
+class Pipeline : public IceUtil::Monitor<IceUtil::Mutex>
+#ifndef ICE_CPP11_MAPPING
+               , public IceUtil::Shared
+#endif
+{
+public:
+
+    Pipeline(int depth) : _depth(depth), _outstanding(0), _failed(false)
+    {
+    }
+
+    void
+    acquire()
+    {
+        Lock sync(*this);
+        while(_outstanding >= _depth)
+        {
+            wait();
+        }
+        ++_outstanding;
+    }
+
+    void
+    response()
+    {
+        Lock sync(*this);
+        --_outstanding;
+        notify();
+    }
+
+    void
+    exception(const Ice::Exception&)
+    {
+        failed();
+    }
+
+    void
+    failed()
+    {
+        Lock sync(*this);
+        _failed = true;
+        --_outstanding;
+        notify();
+    }
+
+    void
+    drain()
+    {
+        Lock sync(*this);
+        while(_outstanding > 0)
+        {
+            wait();
+        }
+        test(!_failed);
+    }
+
+private:
+
+    const int _depth;
+    int _outstanding;
+    bool _failed;
+};
+ICE_DEFINE_PTR(PipelinePtr, Pipeline);
+
+IceUtil::Time
+now()
+{
+    return IceUtil::Time::now(IceUtil::Time::Monotonic);
+}
+
+//
+// Invokes twoway requests from its own thread, several invokers share
+// the same connection.
+//
+class Invoker : public IceUtil::Thread
+{
+public:
+
+    Invoker(const BenchmarkPrxPtr& benchmark, int repetitions) : _benchmark(benchmark), _repetitions(repetitions)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        for(int i = 0; i < _repetitions; ++i)
+        {
+            _benchmark->ping();
+        }
+    }
+
+private:
+
+    const BenchmarkPrxPtr _benchmark;
+    const int _repetitions;
+};
+typedef IceUtil::Handle<Invoker> InvokerPtr;
+
+}
+
+BenchmarkPrxPtr
+allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
+{
+    Ice::PropertiesPtr properties = communicator->getProperties();
+    const int repetitions = properties->getPropertyAsIntWithDefault("Benchmark.Repetitions", 1000);
+    const int warmup = properties->getPropertyAsIntWithDefault("Benchmark.Warmup", 100);
+    const Ice::Long maxBytes = properties->getPropertyAsIntWithDefault("Benchmark.MaxBytes", 32 * 1024 * 1024);
+    test(repetitions > 0);
+
+    Reporter reporter(communicator, collocated);
+
+    string ref = "benchmark:" + getTestEndpoint(communicator, 0);
+    Ice::ObjectPrxPtr base = communicator->stringToProxy(ref);
+    test(base);
+
+    BenchmarkPrxPtr benchmark = ICE_CHECKED_CAST(BenchmarkPrx, base);
+    test(benchmark);
+
+    cout << "warming up... " << flush;
+    for(int i = 0; i < warmup; ++i)
+    {
+        benchmark->ping();
+    }
+    cout << "ok" << endl;
+
+    {
+        cout << "testing twoway latency... " << flush;
+        Result r("twoway");
+        r.latencies.reserve(static_cast<size_t>(repetitions));
+        IceUtil::Time start = now();
+        for(int i = 0; i < repetitions; ++i)
+        {
+            IceUtil::Time t = now();
+            benchmark->ping();
+            r.latencies.push_back((now() - t).toMicroSeconds());
+        }
+        r.elapsed = now() - start;
+        r.count = repetitions;
+        reporter.report(r);
+    }
+
+    {
+        cout << "testing oneway throughput... " << flush;
+        BenchmarkPrxPtr oneway = benchmark->ice_oneway();
+        Result r("oneway");
+        IceUtil::Time start = now();
+        for(int i = 0; i < repetitions; ++i)
+        {
+            oneway->ping();
+        }
+        benchmark->ping(); // Ensure all the oneway requests have been dispatched.
+        r.elapsed = now() - start;
+        r.count = repetitions;
+        reporter.report(r);
+    }
+
+    {
+        cout << "testing batch oneway throughput... " << flush;
+        BenchmarkPrxPtr batchOneway = benchmark->ice_batchOneway();
+        Result r("batchOneway");
+        IceUtil::Time start = now();
+        for(int i = 0; i < repetitions; ++i)
+        {
+            batchOneway->ping();
+        }
+        batchOneway->ice_flushBatchRequests();
+        benchmark->ping();
+        r.elapsed = now() - start;
+        r.count = repetitions;
+        reporter.report(r);
+    }
+
+    {
+        const int depths[] = { 1, 16, 128 };
+        for(size_t d = 0; d < sizeof(depths) / sizeof(int); ++d)
+        {
+            ostringstream name;
+            name << "amiPipeline" << depths[d];
+            cout << "testing AMI pipelining with depth " << depths[d] << "... " << flush;
+
+            Result r(name.str());
+            PipelinePtr pipeline = ICE_MAKE_SHARED(Pipeline, depths[d]);
+#ifndef ICE_CPP11_MAPPING
+            Callback_Benchmark_pingPtr cb = newCallback_Benchmark_ping(pipeline, &Pipeline::response,
+                                                                       &Pipeline::exception);
+#endif
+            IceUtil::Time start = now();
+            for(int i = 0; i < repetitions; ++i)
+            {
+                pipeline->acquire();
+#ifdef ICE_CPP11_MAPPING
+                benchmark->pingAsync([pipeline]() { pipeline->response(); },
+                                     [pipeline](exception_ptr) { pipeline->failed(); });
+#else
+                benchmark->begin_ping(cb);
+#endif
+            }
+            pipeline->drain();
+            r.elapsed = now() - start;
+            r.count = repetitions;
+            reporter.report(r);
+        }
+    }
+
+    {
+        const int threads = properties->getPropertyAsIntWithDefault("Benchmark.Threads", 32);
+        cout << "testing concurrent twoway throughput with " << threads << " threads... " << flush;
+        Result r("concurrentTwoway");
+        vector<InvokerPtr> invokers;
+        IceUtil::Time start = now();
+        for(int i = 0; i < threads; ++i)
+        {
+            invokers.push_back(new Invoker(benchmark, repetitions));
+            invokers.back()->start();
+        }
+        for(vector<InvokerPtr>::const_iterator p = invokers.begin(); p != invokers.end(); ++p)
+        {
+            (*p)->getThreadControl().join();
+        }
+        r.elapsed = now() - start;
+        r.count = threads * repetitions;
+        reporter.report(r);
+    }
+
+    {
+        const int sizes[] = { 1024, 64 * 1024, 1024 * 1024, 8 * 1024 * 1024 };
+        for(size_t s = 0; s < sizeof(sizes) / sizeof(int); ++s)
+        {
+            const int size = sizes[s];
+            const int count = static_cast<int>(max<Ice::Long>(5, min<Ice::Long>(repetitions, maxBytes / size)));
+            ByteSeq seq(static_cast<size_t>(size));
+            for(size_t i = 0; i < seq.size(); ++i)
+            {
+                seq[i] = static_cast<Ice::Byte>(i);
+            }
+
+            ostringstream suffix;
+            suffix << size;
+
+            {
+                cout << "testing byte sequence send bandwidth (" << size << " bytes)... " << flush;
+                Result r("sendByteSeq" + suffix.str());
+                IceUtil::Time start = now();
+                for(int i = 0; i < count; ++i)
+                {
+                    benchmark->sendByteSeq(seq);
+                }
+                r.elapsed = now() - start;
+                r.count = count;
+                r.bytes = static_cast<Ice::Long>(count) * size;
+                reporter.report(r);
+            }
+
+            {
+                cout << "testing byte sequence receive bandwidth (" << size << " bytes)... " << flush;
+                Result r("recvByteSeq" + suffix.str());
+                IceUtil::Time start = now();
+                for(int i = 0; i < count; ++i)
+                {
+                    test(benchmark->recvByteSeq(size).size() == static_cast<size_t>(size));
+                }
+                r.elapsed = now() - start;
+                r.count = count;
+                r.bytes = static_cast<Ice::Long>(count) * size;
+                reporter.report(r);
+            }
+
+            {
+                cout << "testing byte sequence echo bandwidth (" << size << " bytes)... " << flush;
+                Result r("echoByteSeq" + suffix.str());
+                IceUtil::Time start = now();
+                for(int i = 0; i < count; ++i)
+                {
+                    test(benchmark->echoByteSeq(seq).size() == static_cast<size_t>(size));
+                }
+                r.elapsed = now() - start;
+                r.count = count;
+                r.bytes = static_cast<Ice::Long>(count) * size * 2;
+                reporter.report(r);
+
+                test(benchmark->echoByteSeq(seq) == seq);
+            }
+        }
+    }
+
+    {
+        const int sizes[] = { 100, 10000 };
+        for(size_t s = 0; s < sizeof(sizes) / sizeof(int); ++s)
+        {
+            const int size = sizes[s];
+            const int wireSize = 14; // short + int + double
+            const int count = static_cast<int>(max<Ice::Long>(5, min<Ice::Long>(repetitions,
+                                                                                 maxBytes / (size * wireSize))));
+            Fixed f;
+            f.s = 1;
+            f.i = 2;
+            f.d = 3.0;
+            FixedSeq seq(static_cast<size_t>(size), f);
+
+            ostringstream suffix;
+            suffix << size;
+
+            {
+                cout << "testing struct sequence send bandwidth (" << size << " elements)... " << flush;
+                Result r("sendFixedSeq" + suffix.str());
+                IceUtil::Time start = now();
+                for(int i = 0; i < count; ++i)
+                {
+                    benchmark->sendFixedSeq(seq);
+                }
+                r.elapsed = now() - start;
+                r.count = count;
+                r.bytes = static_cast<Ice::Long>(count) * size * wireSize;
+                reporter.report(r);
+            }
+
+            {
+                cout << "testing struct sequence receive bandwidth (" << size << " elements)... " << flush;
+                Result r("recvFixedSeq" + suffix.str());
+                IceUtil::Time start = now();
+                for(int i = 0; i < count; ++i)
+                {
+                    test(benchmark->recvFixedSeq(size).size() == static_cast<size_t>(size));
+                }
+                r.elapsed = now() - start;
+                r.count = count;
+                r.bytes = static_cast<Ice::Long>(count) * size * wireSize;
+                reporter.report(r);
+            }
+        }
+    }
+
+    return benchmark;
+}
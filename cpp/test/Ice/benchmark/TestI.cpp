@@ -0,0 +1,56 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestI.h>
+
+using namespace std;
+
+void
+BenchmarkI::ping(const Ice::Current&)
+{
+}
+
+void
+BenchmarkI::sendByteSeq(ICE_IN(Test::ByteSeq), const Ice::Current&)
+{
+}
+
+Test::ByteSeq
+BenchmarkI::recvByteSeq(Ice::Int size, const Ice::Current&)
+{
+    return Test::ByteSeq(static_cast<size_t>(size));
+}
+
+Test::ByteSeq
+BenchmarkI::echoByteSeq(ICE_IN(Test::ByteSeq) seq, const Ice::Current&)
+{
+    return seq;
+}
+
+void
+BenchmarkI::sendFixedSeq(ICE_IN(Test::FixedSeq), const Ice::Current&)
+{
+}
+
+Test::FixedSeq
+BenchmarkI::recvFixedSeq(Ice::Int size, const Ice::Current&)
+{
+    Test::Fixed f;
+    f.s = 1;
+    f.i = 2;
+    f.d = 3.0;
+    return Test::FixedSeq(static_cast<size_t>(size), f);
+}
+
+void
+BenchmarkI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
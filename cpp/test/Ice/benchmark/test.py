@@ -0,0 +1,16 @@
+# -*- coding: utf-8 -*-
+# **********************************************************************
+#
+# Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+TestSuite(__name__, [
+    ClientServerTestCase(),
+    ClientServerTestCase("client/server with zero-copy byte sequences", client=Client(props={ "Ice.ZeroCopySize" : 1 })),
+    CollocatedTestCase(),
+    CollocatedTestCase("collocated with direct invocations", props={ "Ice.CollocationDirect" : 1 })
+])
@@ -845,6 +845,93 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing connection pool... " << flush;
+    {
+        RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter("Adapter81", "default");
+
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ConnectionPool.Size", "3");
+        Ice::CommunicatorHolder ich(initData);
+
+        TestIntfPrxPtr test = ICE_UNCHECKED_CAST(TestIntfPrx,
+                                                 ich->stringToProxy(adapter->getTestIntf()->ice_toString())->
+                                                 ice_connectionCached(false));
+
+        //
+        // The connections of the pool are established in the background
+        // as requests are sent.
+        //
+        set<Ice::ConnectionPtr> connections;
+        for(int i = 0; i < 100 && connections.size() < 3; ++i)
+        {
+            test->ice_ping();
+            connections.insert(test->ice_getConnection());
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+        test(connections.size() == 3);
+
+        //
+        // Requests are spread over the connections of the pool in
+        // round-robin order.
+        //
+        for(int i = 0; i < 10; ++i)
+        {
+            Ice::ConnectionPtr connection = test->ice_getConnection();
+            test(connections.find(connection) != connections.end());
+            test(test->ice_getConnection() != connection);
+        }
+
+        //
+        // The connections of the pool which are closed are replaced.
+        //
+        Ice::ConnectionPtr killed = *connections.begin();
+        killed->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, Forcefully));
+        connections.erase(killed);
+        for(int i = 0; i < 100 && connections.size() < 3; ++i)
+        {
+            test->ice_ping();
+            connections.insert(test->ice_getConnection());
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+        test(connections.size() == 3);
+        test(connections.find(killed) == connections.end());
+
+        for(set<Ice::ConnectionPtr>::const_iterator p = connections.begin(); p != connections.end(); ++p)
+        {
+            (*p)->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, Forcefully));
+        }
+        set<Ice::ConnectionPtr> killedConnections;
+        killedConnections.swap(connections);
+        for(int i = 0; i < 100 && connections.size() < 3; ++i)
+        {
+            test->ice_ping();
+            connections.insert(test->ice_getConnection());
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+        test(connections.size() == 3);
+        for(set<Ice::ConnectionPtr>::const_iterator p = connections.begin(); p != connections.end(); ++p)
+        {
+            test(killedConnections.find(*p) == killedConnections.end());
+        }
+
+        com->deactivateObjectAdapter(adapter);
+    }
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ConnectionPool.Selection", "Random");
+        try
+        {
+            Ice::CommunicatorHolder ich(initData);
+            test(false);
+        }
+        catch(const Ice::InitializationException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
     if(!communicator->getProperties()->getProperty("Ice.Plugin.IceSSL").empty() &&
        communicator->getProperties()->getProperty("Ice.Default.Protocol") == "ssl")
     {
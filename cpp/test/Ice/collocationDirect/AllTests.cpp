@@ -0,0 +1,215 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <Test.h>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+
+class TestIntfI : public virtual TestIntf
+{
+public:
+
+#ifdef ICE_CPP11_MAPPING
+    virtual ByteSeq
+    opByteSeq(ByteSeq s1, ByteSeq& s2, const Ice::Current&)
+#else
+    virtual ByteSeq
+    opByteSeq(const ByteSeq& s1, ByteSeq& s2, const Ice::Current&)
+#endif
+    {
+        s2 = s1;
+        reverse(s2.begin(), s2.end());
+        return s1;
+    }
+
+#ifdef ICE_CPP11_MAPPING
+    virtual ByteSeq
+    opNested(ByteSeq s1, const Ice::Current& current)
+#else
+    virtual ByteSeq
+    opNested(const ByteSeq& s1, const Ice::Current& current)
+#endif
+    {
+        TestIntfPrxPtr prx = ICE_UNCHECKED_CAST(TestIntfPrx,
+                                                current.adapter->createProxy(Ice::stringToIdentity("test")));
+        ByteSeq s2;
+        test(prx->opByteSeq(s1, s2) == s1);
+        return s2;
+    }
+
+#ifdef ICE_CPP11_MAPPING
+    virtual void
+    opException(ByteSeq s1, const Ice::Current&)
+#else
+    virtual void
+    opException(const ByteSeq& s1, const Ice::Current&)
+#endif
+    {
+        TestException ex;
+        ex.reason = s1.empty() ? "empty" : "not empty";
+        throw ex;
+    }
+};
+
+class InterceptorI : public Ice::DispatchInterceptor
+{
+public:
+
+    InterceptorI(const Ice::ObjectPtr& servant) : _servant(servant)
+    {
+    }
+
+    virtual bool
+    dispatch(Ice::Request& request)
+    {
+        return _servant->ice_dispatch(request);
+    }
+
+private:
+
+    const Ice::ObjectPtr _servant;
+};
+
+//
+// Invoke opByteSeq and return how many times the sequences were
+// marshaled: 3 if the invocation marshaled its parameters and results,
+// 0 if they were passed directly.
+//
+int
+opByteSeq(const TestIntfPrxPtr& prx, bool async = false)
+{
+    ByteSeq s1(100, 1);
+    s1[0] = 0;
+    ByteSeq s2;
+    ByteSeq r;
+
+    CountedSeq::writeCount() = 0;
+    if(async)
+    {
+#ifdef ICE_CPP11_MAPPING
+        auto result = prx->opByteSeqAsync(s1).get();
+        r = result.returnValue;
+        s2 = result.s2;
+#else
+        r = prx->end_opByteSeq(s2, prx->begin_opByteSeq(s1));
+#endif
+    }
+    else
+    {
+        r = prx->opByteSeq(s1, s2);
+    }
+    test(r == s1);
+    test(s2.size() == s1.size() && s2.back() == 0 && s2.front() == 1);
+    return CountedSeq::writeCount();
+}
+
+}
+
+void
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    //
+    // Parameters are only passed directly with the C++11 mapping.
+    //
+#ifdef ICE_CPP11_MAPPING
+    const bool direct = true;
+#else
+    const bool direct = false;
+#endif
+
+    Ice::InitializationData initData;
+    initData.properties = communicator->getProperties()->clone();
+    initData.properties->setProperty("Ice.CollocationDirect", "1");
+    initData.properties->setProperty("TestAdapter.Endpoints", getTestEndpoint(communicator, 0));
+    Ice::CommunicatorPtr com = Ice::initialize(initData);
+
+    Ice::ObjectAdapterPtr adapter = com->createObjectAdapter("TestAdapter");
+    Ice::ObjectPtr servant = ICE_MAKE_SHARED(TestIntfI);
+    adapter->add(servant, Ice::stringToIdentity("test"));
+    adapter->add(ICE_MAKE_SHARED(InterceptorI, servant), Ice::stringToIdentity("interceptor"));
+    adapter->activate();
+
+    TestIntfPrxPtr prx = ICE_UNCHECKED_CAST(TestIntfPrx,
+                                            com->stringToProxy("test:" + getTestEndpoint(communicator, 0)));
+
+    cout << "testing direct invocations... " << flush;
+    {
+        test(opByteSeq(prx) == (direct ? 0 : 3));
+        test(opByteSeq(prx) == (direct ? 0 : 3));
+
+        //
+        // The servant invokes opByteSeq on the same servant.
+        //
+        ByteSeq s1(10, 1);
+        s1[0] = 0;
+        CountedSeq::writeCount() = 0;
+        ByteSeq r = prx->opNested(s1);
+        test(r.size() == s1.size() && r.back() == 0 && r.front() == 1);
+        test(CountedSeq::writeCount() == (direct ? 0 : 5));
+
+        CountedSeq::writeCount() = 0;
+        try
+        {
+            prx->opException(s1);
+            test(false);
+        }
+        catch(const TestException& ex)
+        {
+            test(ex.reason == "not empty");
+        }
+        test(CountedSeq::writeCount() == (direct ? 0 : 1));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing marshaled parameters... " << flush;
+    {
+        //
+        // The interceptor dispatches the request as usual, the parameters
+        // are marshaled when it's dispatched.
+        //
+        test(opByteSeq(ICE_UNCHECKED_CAST(TestIntfPrx,
+                                          prx->ice_identity(Ice::stringToIdentity("interceptor")))) == 3);
+
+        //
+        // Asynchronous invocations and invocations with an invocation
+        // timeout are marshaled.
+        //
+        test(opByteSeq(prx, true) == 3);
+        test(opByteSeq(prx->ice_invocationTimeout(10000)) == 3);
+
+        //
+        // The request is sent over a connection, it's queued until the
+        // connection is established.
+        //
+        test(opByteSeq(prx->ice_collocationOptimized(false)) == 3);
+        test(opByteSeq(prx->ice_collocationOptimized(false)) == 3);
+        test(opByteSeq(prx) == (direct ? 0 : 3));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing disabled direct invocations... " << flush;
+    {
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.CollocationDirect", "0");
+        Ice::CommunicatorPtr com2 = Ice::initialize(initData);
+        Ice::ObjectAdapterPtr adapter2 = com2->createObjectAdapter("");
+        TestIntfPrxPtr prx2 = ICE_UNCHECKED_CAST(TestIntfPrx, adapter2->addWithUUID(ICE_MAKE_SHARED(TestIntfI)));
+        test(opByteSeq(prx2) == 3);
+        com2->destroy();
+    }
+    cout << "ok" << endl;
+
+    com->destroy();
+}
@@ -0,0 +1,72 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef TEST_COUNTED_SEQ_H
+#define TEST_COUNTED_SEQ_H
+
+#include <Ice/Ice.h>
+
+namespace Test
+{
+
+//
+// A byte sequence which counts how many times it's marshaled.
+//
+class CountedSeq : public std::vector<Ice::Byte>
+{
+public:
+
+    CountedSeq()
+    {
+    }
+
+    CountedSeq(size_t size, Ice::Byte value) : std::vector<Ice::Byte>(size, value)
+    {
+    }
+
+    static int& writeCount()
+    {
+        static int count = 0;
+        return count;
+    }
+};
+
+}
+
+namespace Ice
+{
+
+template<>
+struct StreamableTraits< ::Test::CountedSeq>
+{
+    static const StreamHelperCategory helper = StreamHelperCategorySequence;
+    static const int minWireSize = 1;
+    static const bool fixedLength = false;
+};
+
+template<>
+struct StreamHelper< ::Test::CountedSeq, StreamHelperCategorySequence>
+{
+    template<class S> static inline void
+    write(S* stream, const ::Test::CountedSeq& v)
+    {
+        ++::Test::CountedSeq::writeCount();
+        stream->write(static_cast<const std::vector<Ice::Byte>&>(v));
+    }
+
+    template<class S> static inline void
+    read(S* stream, ::Test::CountedSeq& v)
+    {
+        stream->read(static_cast<std::vector<Ice::Byte>&>(v));
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,301 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <Test.h>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+
+class TestIntfI : public virtual TestIntf
+{
+public:
+
+#ifdef ICE_CPP11_MAPPING
+    virtual Ice::ByteSeq
+    echo(Ice::ByteSeq seq, const Ice::Current&)
+#else
+    virtual Ice::ByteSeq
+    echo(const Ice::ByteSeq& seq, const Ice::Current&)
+#endif
+    {
+        return seq;
+    }
+};
+
+//
+// Records the compression status of the messages traced by the client
+// with Ice.Trace.Protocol.
+//
+class LoggerI : public Ice::Logger,
+                private IceUtil::Mutex
+#ifdef ICE_CPP11_MAPPING
+              , public std::enable_shared_from_this<LoggerI>
+#endif
+{
+public:
+
+    virtual void
+    print(const string&)
+    {
+    }
+
+    virtual void
+    trace(const string& category, const string& message)
+    {
+        string::size_type pos = message.find("compression status = ");
+        if(category != "Protocol" || pos == string::npos)
+        {
+            return;
+        }
+        int status = atoi(message.c_str() + pos + 21);
+
+        Lock sync(*this);
+        if(message.find("received validate connection") == 0)
+        {
+            _validate.push_back(status);
+        }
+        else if(message.find("sending request") == 0)
+        {
+            _requests.push_back(status);
+        }
+        else if(message.find("received reply") == 0)
+        {
+            _replies.push_back(status);
+        }
+    }
+
+    virtual void
+    warning(const string& message)
+    {
+        cerr << "warning: " << message << endl;
+    }
+
+    virtual void
+    error(const string& message)
+    {
+        cerr << "error: " << message << endl;
+    }
+
+    virtual string
+    getPrefix()
+    {
+        return "";
+    }
+
+    virtual Ice::LoggerPtr
+    cloneWithPrefix(const string&)
+    {
+        return ICE_SHARED_FROM_THIS;
+    }
+
+    vector<int>
+    validate()
+    {
+        Lock sync(*this);
+        return _validate;
+    }
+
+    vector<int>
+    requests()
+    {
+        Lock sync(*this);
+        return _requests;
+    }
+
+    vector<int>
+    replies()
+    {
+        Lock sync(*this);
+        return _replies;
+    }
+
+private:
+
+    vector<int> _validate;
+    vector<int> _requests;
+    vector<int> _replies;
+};
+ICE_DEFINE_PTR(LoggerIPtr, LoggerI);
+
+int
+codecId(const string& codec)
+{
+    if(codec == "zstd")
+    {
+        return 3;
+    }
+    else if(codec == "lz4")
+    {
+        return 4;
+    }
+    test(codec == "bzip2");
+    return 2;
+}
+
+//
+// The compression status of an uncompressed message which requests a
+// compressed response. Status 1 denotes bzip2 and is also the status
+// sent by the peers which don't know about the other codecs.
+//
+int
+uncompressedStatus(const string& codec)
+{
+    return codec == "bzip2" ? 1 : (0x80 | codecId(codec));
+}
+
+bool
+isSupported(const Ice::CommunicatorPtr& communicator, const string& codec)
+{
+    Ice::InitializationData initData;
+    initData.properties = communicator->getProperties()->clone();
+    initData.properties->setProperty("Ice.Compression.Codec", codec);
+    try
+    {
+        Ice::initialize(initData)->destroy();
+        return true;
+    }
+    catch(const Ice::InitializationException&)
+    {
+        return false;
+    }
+}
+
+void
+testCodecs(const Ice::CommunicatorPtr& communicator, const string& serverCodec, const string& clientCodec)
+{
+    Ice::InitializationData initData;
+    initData.properties = communicator->getProperties()->clone();
+    initData.properties->setProperty("Ice.Compression.Codec", serverCodec);
+    initData.properties->setProperty("TestAdapter.Endpoints", getTestEndpoint(communicator, 0));
+    Ice::CommunicatorPtr server = Ice::initialize(initData);
+    Ice::ObjectAdapterPtr adapter = server->createObjectAdapter("TestAdapter");
+    adapter->add(ICE_MAKE_SHARED(TestIntfI), Ice::stringToIdentity("test"));
+    adapter->activate();
+
+    LoggerIPtr logger = ICE_MAKE_SHARED(LoggerI);
+    initData.properties = communicator->getProperties()->clone();
+    initData.properties->setProperty("Ice.Compression.Codec", clientCodec);
+    initData.properties->setProperty("Ice.Trace.Protocol", "1");
+    initData.logger = logger;
+    Ice::CommunicatorPtr client = Ice::initialize(initData);
+
+    TestIntfPrxPtr prx = ICE_UNCHECKED_CAST(TestIntfPrx,
+                                            client->stringToProxy("test:" + getTestEndpoint(communicator, 0)));
+    prx = prx->ice_compress(true);
+
+    //
+    // Messages smaller than 100 bytes aren't compressed, the first request
+    // shows the codec of the client to the server.
+    //
+    Ice::ByteSeq small;
+    test(prx->echo(small) == small);
+
+    Ice::ByteSeq large(64 * 1024);
+    for(size_t i = 0; i < large.size(); ++i)
+    {
+        large[i] = static_cast<Ice::Byte>(i % 16);
+    }
+    test(prx->echo(large) == large);
+    test(prx->echo(large) == large);
+
+    client->destroy();
+    server->destroy();
+
+    //
+    // Both peers use their codec if it's the same, otherwise they fall
+    // back to bzip2.
+    //
+    int compressed = serverCodec == clientCodec ? codecId(clientCodec) : 2;
+
+    vector<int> validate = logger->validate();
+    test(validate.size() == 1);
+    test(validate[0] == (serverCodec == "bzip2" ? 0 : uncompressedStatus(serverCodec)));
+
+    vector<int> requests = logger->requests();
+    test(requests.size() == 3);
+    test(requests[0] == uncompressedStatus(clientCodec));
+    test(requests[1] == compressed);
+    test(requests[2] == compressed);
+
+    vector<int> replies = logger->replies();
+    test(replies.size() == 3);
+    test(replies[0] == uncompressedStatus(serverCodec));
+    test(replies[1] == compressed);
+    test(replies[2] == compressed);
+}
+
+}
+
+void
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    cout << "testing unsupported codec... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.Compression.Codec", "unknown");
+        try
+        {
+            Ice::initialize(initData);
+            test(false);
+        }
+        catch(const Ice::InitializationException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
+    //
+    // zstd and lz4 are only supported if Ice is built with these codecs,
+    // they are rejected like unknown codecs otherwise.
+    //
+    vector<string> codecs;
+    codecs.push_back("bzip2");
+    if(isSupported(communicator, "zstd"))
+    {
+        codecs.push_back("zstd");
+    }
+    if(isSupported(communicator, "lz4"))
+    {
+        codecs.push_back("lz4");
+    }
+
+    cout << "testing codec selection... " << flush;
+    for(vector<string>::const_iterator p = codecs.begin(); p != codecs.end(); ++p)
+    {
+        testCodecs(communicator, *p, *p);
+    }
+    cout << "ok" << endl;
+
+    if(codecs.size() > 1)
+    {
+        //
+        // A bzip2 peer handles the status of the uncompressed messages
+        // sent by the other codecs like status 1, as do the peers which
+        // don't know about these codecs.
+        //
+        cout << "testing codec fallback... " << flush;
+        for(vector<string>::const_iterator p = codecs.begin(); p != codecs.end(); ++p)
+        {
+            for(vector<string>::const_iterator q = codecs.begin(); q != codecs.end(); ++q)
+            {
+                if(*p != *q)
+                {
+                    testCodecs(communicator, *p, *q);
+                }
+            }
+        }
+        cout << "ok" << endl;
+    }
+}
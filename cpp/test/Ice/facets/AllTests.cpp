@@ -118,6 +118,48 @@ allTests(const Ice::CommunicatorPtr& communicator)
         test(fm[""] == obj3);
         cout << "ok" << endl;
 
+        cout << "testing many servants... " << flush;
+        const int count = 1000;
+        for(int i = 0; i < count; ++i)
+        {
+            ostringstream os;
+            os << "cat" << i % 7 << "/id" << i;
+            Ice::Identity id = Ice::stringToIdentity(os.str());
+            adapter->add(obj1, id);
+            adapter->addFacet(obj2, id, "f");
+        }
+        for(int i = 0; i < count; ++i)
+        {
+            ostringstream os;
+            os << "cat" << i % 7 << "/id" << i;
+            Ice::Identity id = Ice::stringToIdentity(os.str());
+            test(adapter->find(id) == obj1);
+            test(adapter->findFacet(id, "f") == obj2);
+            test(adapter->findAllFacets(id).size() == 2);
+            if(i % 2 == 0)
+            {
+                test(adapter->remove(id) == obj1);
+                test(adapter->removeFacet(id, "f") == obj2);
+            }
+        }
+        for(int i = 0; i < count; ++i)
+        {
+            ostringstream os;
+            os << "cat" << i % 7 << "/id" << i;
+            Ice::Identity id = Ice::stringToIdentity(os.str());
+            if(i % 2 == 0)
+            {
+                test(!adapter->find(id));
+                test(adapter->findAllFacets(id).empty());
+            }
+            else
+            {
+                test(adapter->find(id) == obj1);
+                test(adapter->removeAllFacets(id).size() == 2);
+            }
+        }
+        cout << "ok" << endl;
+
         adapter->deactivate();
     }
 
@@ -313,6 +313,67 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing dispatch deadlines... " << flush;
+    {
+        //
+        // The server dispatches the requests of this adapter with a single
+        // executor thread, ordered by deadline. The first request keeps the
+        // thread busy while the others are queued, the request with a null
+        // dispatch budget must overtake the requests queued before it,
+        // even if it's compressed. The request with a huge budget must be
+        // dispatched last.
+        //
+        HoldPrxPtr holdDeadline = ICE_UNCHECKED_CAST(HoldPrx,
+                                                     communicator->stringToProxy("hold:" +
+                                                                                 getTestEndpoint(communicator, 2)));
+        holdDeadline->set(0, 0);
+
+        Ice::Context ctx;
+        ctx["_deadline"] = "0";
+        ctx["padding"] = string(200, 'x'); // Large enough to be compressed.
+        Ice::Context lateCtx;
+        lateCtx["_deadline"] = "9223372036854775807";
+        HoldPrxPtr holdCompress = holdDeadline->ice_compress(true);
+#ifdef ICE_CPP11_MAPPING
+        auto first = holdDeadline->setAsync(1, 1000);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        auto late = holdDeadline->setAsync(200, 0, lateCtx);
+        vector<future<int>> results;
+        for(int i = 2; i < 12; ++i)
+        {
+            results.push_back(holdDeadline->setAsync(i, 0));
+        }
+        auto urgent = holdCompress->setAsync(100, 0, ctx);
+        test(first.get() == 0);
+        test(urgent.get() == 1);
+        test(results[0].get() == 100);
+        for(int i = 1; i < 10; ++i)
+        {
+            test(results[i].get() == i + 1);
+        }
+        test(late.get() == 11);
+#else
+        Ice::AsyncResultPtr first = holdDeadline->begin_set(1, 1000);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        Ice::AsyncResultPtr late = holdDeadline->begin_set(200, 0, lateCtx);
+        vector<Ice::AsyncResultPtr> results;
+        for(int i = 2; i < 12; ++i)
+        {
+            results.push_back(holdDeadline->begin_set(i, 0));
+        }
+        Ice::AsyncResultPtr urgent = holdCompress->begin_set(100, 0, ctx);
+        test(holdDeadline->end_set(first) == 0);
+        test(holdCompress->end_set(urgent) == 1);
+        test(holdDeadline->end_set(results[0]) == 100);
+        for(int i = 1; i < 10; ++i)
+        {
+            test(holdDeadline->end_set(results[i]) == i + 1);
+        }
+        test(holdDeadline->end_set(late) == 11);
+#endif
+    }
+    cout << "ok" << endl;
+
     cout << "testing waitForHold... " << flush;
     {
         hold->waitForHold();
@@ -36,8 +36,16 @@ run(int, char**, const Ice::CommunicatorPtr& communicator)
     Ice::ObjectAdapterPtr adapter2 = communicator->createObjectAdapter("TestAdapter2");
     adapter2->add(ICE_MAKE_SHARED(HoldI, timer, adapter2), Ice::stringToIdentity("hold"));
 
+    communicator->getProperties()->setProperty("TestAdapter3.Endpoints", getTestEndpoint(communicator, 2));
+    communicator->getProperties()->setProperty("TestAdapter3.ThreadPool.Size", "1");
+    communicator->getProperties()->setProperty("TestAdapter3.ThreadPool.ExecutorSize", "1");
+    communicator->getProperties()->setProperty("TestAdapter3.ThreadPool.ExecutorDeadline", "60000");
+    Ice::ObjectAdapterPtr adapter3 = communicator->createObjectAdapter("TestAdapter3");
+    adapter3->add(ICE_MAKE_SHARED(HoldI, timer, adapter3), Ice::stringToIdentity("hold"));
+
     adapter1->activate();
     adapter2->activate();
+    adapter3->activate();
 
     TEST_READY
 
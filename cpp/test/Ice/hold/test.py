@@ -0,0 +1,16 @@
+# -*- coding: utf-8 -*-
+# **********************************************************************
+#
+# Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+TestSuite(__name__, [
+    ClientServerTestCase(),
+    ClientServerTestCase("client/server with dispatch executor",
+                         server=Server(props={ "TestAdapter1.ThreadPool.ExecutorSize" : 3,
+                                               "TestAdapter2.ThreadPool.ExecutorSize" : 3 })),
+])
@@ -55,6 +55,19 @@ private:
 };
 typedef IceUtil::Handle<Callback> CallbackPtr;
 
+#ifndef ICE_CPP11_MAPPING
+class ConnectionCompressionMetricsFactory : public Ice::ValueFactory
+{
+public:
+
+    virtual Ice::ObjectPtr
+    create(const string&)
+    {
+        return new ConnectionCompressionMetrics;
+    }
+};
+#endif
+
 string
 getPort(const Ice::PropertiesAdminPrxPtr& p)
 {
@@ -630,6 +643,62 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
         test(sm2->receivedBytes - sm1->receivedBytes == requestSz + static_cast<int>(bs.size()) + 4);
         test(sm2->sentBytes - sm1->sentBytes == replySz);
 
+        //
+        // The connection metrics of Ice for C++ also provide the
+        // compression metrics.
+        //
+#ifdef ICE_CPP11_MAPPING
+        communicator->getValueFactoryManager()->add(
+            [](const string&) { return make_shared<ConnectionCompressionMetrics>(); },
+            "::IceMX::ConnectionCompressionMetrics");
+#else
+        communicator->getValueFactoryManager()->add(new ConnectionCompressionMetricsFactory,
+                                                    "::IceMX::ConnectionCompressionMetrics");
+#endif
+        ConnectionCompressionMetricsPtr ccm1, ccm2;
+        ccm1 = ICE_DYNAMIC_CAST(ConnectionCompressionMetrics,
+                                clientMetrics->getMetricsView("View", timestamp)["Connection"][0]);
+        test(ccm1 && ccm1->compressed == 0 && ccm1->compressionSkipped == 0 && ccm1->compressionInputBytes == 0 &&
+             ccm1->compressionOutputBytes == 0 && ccm1->compressionTime == 0);
+
+        bs.assign(512, 0);
+        metrics->ice_compress(true)->opByteS(bs);
+
+        ccm2 = ICE_DYNAMIC_CAST(ConnectionCompressionMetrics,
+                                clientMetrics->getMetricsView("View", timestamp)["Connection"][0]);
+        test(ccm2->compressed == 1 && ccm2->compressionSkipped == 0);
+        test(ccm2->compressionOutputBytes > 0 && ccm2->compressionOutputBytes < ccm2->compressionInputBytes);
+
+        ccm1 = ccm2;
+
+        //
+        // Incompressible payloads are sent uncompressed and, with the
+        // adaptive compression enabled, the following messages of the
+        // same size aren't compressed anymore.
+        //
+        bs.resize(2048);
+        unsigned int seed = 1;
+        for(Test::ByteSeq::iterator p = bs.begin(); p != bs.end(); ++p)
+        {
+            seed = seed * 1103515245 + 12345;
+            *p = static_cast<Ice::Byte>(seed >> 16);
+        }
+        metrics->ice_compress(true)->opByteS(bs);
+
+        ccm2 = ICE_DYNAMIC_CAST(ConnectionCompressionMetrics,
+                                clientMetrics->getMetricsView("View", timestamp)["Connection"][0]);
+        test(ccm2->compressed - ccm1->compressed == 1);
+        test(ccm2->compressionSkipped - ccm1->compressionSkipped == 1);
+
+        ccm1 = ccm2;
+
+        metrics->ice_compress(true)->opByteS(bs);
+
+        ccm2 = ICE_DYNAMIC_CAST(ConnectionCompressionMetrics,
+                                clientMetrics->getMetricsView("View", timestamp)["Connection"][0]);
+        test(ccm2->compressed == ccm1->compressed);
+        test(ccm2->compressionSkipped - ccm1->compressionSkipped == 1);
+
         props["IceMX.Metrics.View.Map.Connection.GroupBy"] = "state";
         updateProps(clientProps, serverProps, update.get(), props, "Connection");
 
@@ -57,5 +57,143 @@ allTests(const Ice::CommunicatorPtr& communicator)
     batchOnewaysAMI(derived);
     cout << "ok" << endl;
 
+    if(cl->ice_getConnection()) // Not supported with collocated tests, the adapter isn't activated.
+    {
+        cout << "testing gathered writes of queued requests... " << flush;
+        //
+        // With a small send buffer, the requests queued while a request
+        // is being sent are gathered in writes which are interrupted in
+        // the middle of a request or of its header.
+        //
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.TCP.SndSize", "4096");
+        Ice::CommunicatorPtr comm = Ice::initialize(initData);
+        Test::MyClassPrxPtr prx = ICE_UNCHECKED_CAST(Test::MyClassPrx, comm->stringToProxy(ref));
+
+        vector<Test::ByteS> seqs;
+        for(int i = 0; i < 40; ++i)
+        {
+            Test::ByteS seq(static_cast<size_t>(i * 997 + 1));
+            for(size_t j = 0; j < seq.size(); ++j)
+            {
+                seq[j] = static_cast<Ice::Byte>(i + j);
+            }
+            seqs.push_back(seq);
+        }
+
+#ifdef ICE_CPP11_MAPPING
+        vector<future<Test::MyClass::OpByteSResult>> results;
+        for(vector<Test::ByteS>::const_iterator p = seqs.begin(); p != seqs.end(); ++p)
+        {
+            results.push_back(prx->opByteSAsync(*p, Test::ByteS()));
+        }
+        for(size_t i = 0; i < seqs.size(); ++i)
+        {
+            Test::MyClass::OpByteSResult r = results[i].get();
+            test(r.returnValue == seqs[i]);
+            test(equal(r.p3.rbegin(), r.p3.rend(), seqs[i].begin()));
+        }
+#else
+        vector<Ice::AsyncResultPtr> results;
+        for(vector<Test::ByteS>::const_iterator p = seqs.begin(); p != seqs.end(); ++p)
+        {
+            results.push_back(prx->begin_opByteS(*p, Test::ByteS()));
+        }
+        for(size_t i = 0; i < seqs.size(); ++i)
+        {
+            Test::ByteS p3;
+            test(prx->end_opByteS(p3, results[i]) == seqs[i]);
+            test(equal(p3.rbegin(), p3.rend(), seqs[i].begin()));
+        }
+#endif
+        comm->destroy();
+        cout << "ok" << endl;
+
+        cout << "testing zero-copy byte sequences... " << flush;
+        //
+        // The sequences of synchronous invocations are sent from the
+        // caller's memory, the small send buffer interrupts the writes
+        // before or in the middle of the sequences.
+        //
+        initData.properties->setProperty("Ice.ZeroCopySize", "1");
+        comm = Ice::initialize(initData);
+        prx = ICE_UNCHECKED_CAST(Test::MyClassPrx, comm->stringToProxy(ref));
+        for(int i = 0; i < 20; ++i)
+        {
+            Test::ByteS seq1(static_cast<size_t>(i * 7919 + 1000));
+            for(size_t j = 0; j < seq1.size(); ++j)
+            {
+                seq1[j] = static_cast<Ice::Byte>(i + j);
+            }
+            Test::ByteS seq2(seq1.rbegin(), seq1.rend());
+            Test::ByteS p3;
+            Test::ByteS r = prx->opByteS(seq1, seq2, p3);
+            test(r.size() == seq1.size() + seq2.size());
+            test(equal(seq1.begin(), seq1.end(), r.begin()));
+            test(equal(seq2.begin(), seq2.end(), r.begin() + seq1.size()));
+            test(equal(p3.rbegin(), p3.rend(), seq1.begin()));
+        }
+        comm->destroy();
+        cout << "ok" << endl;
+    }
+
+    cout << "testing messages around the read-ahead size... " << flush;
+    {
+        //
+        // With Ice.ReadAheadSize=1, the requests and replies are smaller
+        // than, equal to or larger than the read-ahead buffer. The AMI
+        // requests are sent in bursts which are read ahead together.
+        //
+        vector<Test::ByteS> seqs;
+        for(int size = 400; size < 1100; ++size)
+        {
+            Test::ByteS seq(static_cast<size_t>(size));
+            for(size_t j = 0; j < seq.size(); ++j)
+            {
+                seq[j] = static_cast<Ice::Byte>(size + j);
+            }
+            seqs.push_back(seq);
+        }
+
+        for(vector<Test::ByteS>::const_iterator p = seqs.begin(); p != seqs.end(); ++p)
+        {
+            Test::ByteS p3;
+            test(cl->opByteS(*p, Test::ByteS(), p3) == *p);
+            test(equal(p3.rbegin(), p3.rend(), p->begin()));
+        }
+
+        for(size_t i = 0; i < seqs.size(); i += 50)
+        {
+            size_t last = min(i + 50, seqs.size());
+#ifdef ICE_CPP11_MAPPING
+            vector<future<Test::MyClass::OpByteSResult>> results;
+            for(size_t j = i; j < last; ++j)
+            {
+                results.push_back(cl->opByteSAsync(seqs[j], Test::ByteS()));
+            }
+            for(size_t j = i; j < last; ++j)
+            {
+                Test::MyClass::OpByteSResult r = results[j - i].get();
+                test(r.returnValue == seqs[j]);
+                test(equal(r.p3.rbegin(), r.p3.rend(), seqs[j].begin()));
+            }
+#else
+            vector<Ice::AsyncResultPtr> results;
+            for(size_t j = i; j < last; ++j)
+            {
+                results.push_back(cl->begin_opByteS(seqs[j], Test::ByteS()));
+            }
+            for(size_t j = i; j < last; ++j)
+            {
+                Test::ByteS p3;
+                test(cl->end_opByteS(p3, results[j - i]) == seqs[j]);
+                test(equal(p3.rbegin(), p3.rend(), seqs[j].begin()));
+            }
+#endif
+        }
+    }
+    cout << "ok" << endl;
+
     return cl;
 }
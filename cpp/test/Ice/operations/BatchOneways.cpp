@@ -199,6 +199,33 @@ batchOneways(const Test::MyClassPrxPtr& p)
         ic->destroy();
     }
 
+    if(batch->ice_getConnection())
+    {
+        //
+        // Batches are flushed once the auto flush delay elapsed.
+        //
+        Ice::InitializationData initData;
+        initData.properties = p->ice_getCommunicator()->getProperties()->clone();
+        initData.properties->setProperty("Ice.BatchAutoFlushDelay", "1000");
+        Ice::CommunicatorHolder ich(initData);
+
+        Test::MyClassPrxPtr batch =
+            ICE_UNCHECKED_CAST(Test::MyClassPrx, ich->stringToProxy(p->ice_toString()))->ice_batchOneway();
+
+        p->opByteSOnewayCallCount(); // Reset the call count
+        batch->opByteSOneway(bs1);
+        batch->opByteSOneway(bs1);
+        batch->opByteSOneway(bs1);
+
+        int count = 0;
+        for(int i = 0; i < 500 && count < 3; ++i)
+        {
+            count += p->opByteSOnewayCallCount();
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+        test(count == 3);
+    }
+
     if(batch->ice_getConnection() &&
        p->ice_getCommunicator()->getProperties()->getProperty("Ice.Override.Compress") == "")
     {
@@ -0,0 +1,31 @@
+# -*- coding: utf-8 -*-
+# **********************************************************************
+#
+# Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+TestSuite(__name__, [
+    ClientServerTestCase(),
+    ClientAMDServerTestCase(),
+    ClientServerTestCase("client/server with read-ahead", props={ "Ice.ReadAheadSize" : 1 }),
+    ClientServerTestCase("client/server with dispatch executor",
+                         server=Server(props={ "Ice.ThreadPool.Server.ExecutorSize" : 4 })),
+    ClientServerTestCase("client/server with serialized dispatch executor",
+                         server=Server(props={ "Ice.ThreadPool.Server.ExecutorSize" : 2,
+                                               "Ice.ThreadPool.Server.Serialize" : 1 })),
+    ClientServerTestCase("client/server with dispatch deadlines",
+                         server=Server(props={ "Ice.ThreadPool.Server.ExecutorSize" : 2,
+                                               "Ice.ThreadPool.Server.ExecutorDeadline" : 100,
+                                               "TestAdapter.DispatchDeadline.opByteSOneway" : 1000 })),
+    ClientServerTestCase("client/server with thread affinity",
+                         server=Server(props={ "Ice.ThreadAffinity" : "0",
+                                               "Ice.ThreadPool.Server.Reactors" : 2,
+                                               "Ice.ThreadPool.Server.ReactorAffinity" : 1,
+                                               "Ice.ThreadPool.Server.ExecutorSize" : 2 })),
+    CollocatedTestCase(),
+    CollocatedTestCase("collocated with direct invocations", props={ "Ice.CollocationDirect" : 1 })
+])
@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Ice.h>
+#include <IceUtil/Thread.h>
 #include <TestCommon.h>
 #include <Test.h>
 
@@ -126,6 +127,17 @@ public:
     {
     }
 };
+
+class BufferPoolMetricsFactory : public Ice::ValueFactory
+{
+public:
+
+    virtual Ice::ObjectPtr
+    create(const string&)
+    {
+        return new BufferPoolMetrics;
+    }
+};
 #endif
 
 #ifdef ICE_CPP11_MAPPING
@@ -227,6 +239,114 @@ public:
 };
 #endif
 
+namespace
+{
+
+//
+// Marshal and unmarshal byte sequences which use a buffer of each size
+// class of the buffer pool, and a larger buffer.
+//
+void
+marshalSequences(const Ice::CommunicatorPtr& communicator)
+{
+    for(int i = 0; i < 20; ++i)
+    {
+        for(size_t size = 100; size < 128 * 1024; size *= 2)
+        {
+            vector<Ice::Byte> v(size, static_cast<Ice::Byte>(i + size));
+            Ice::OutputStream out(communicator);
+            out.write(v);
+            Ice::InputStream in(communicator, out.finished());
+            vector<Ice::Byte> v2;
+            in.read(v2);
+            test(v2 == v);
+        }
+    }
+}
+
+class MarshalThread : public IceUtil::Thread
+{
+public:
+
+    MarshalThread(const Ice::CommunicatorPtr& communicator) : _communicator(communicator)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        marshalSequences(_communicator);
+    }
+
+private:
+
+    const Ice::CommunicatorPtr _communicator;
+};
+
+//
+// The buffers cached by a thread are released to the shared pool when
+// the thread exits.
+//
+void
+marshalSequencesWithThreads(const Ice::CommunicatorPtr& communicator)
+{
+    vector<IceUtil::ThreadControl> threads;
+    for(int i = 0; i < 4; ++i)
+    {
+        IceUtil::ThreadPtr t = new MarshalThread(communicator);
+        threads.push_back(t->start());
+    }
+    for(vector<IceUtil::ThreadControl>::iterator p = threads.begin(); p != threads.end(); ++p)
+    {
+        p->join();
+    }
+}
+
+BufferPoolMetricsPtr
+getBufferPoolMetrics(const Ice::CommunicatorPtr& communicator)
+{
+    IceMX::MetricsAdminPtr metrics = ICE_DYNAMIC_CAST(IceMX::MetricsAdmin, communicator->findAdminFacet("Metrics"));
+    test(metrics);
+    Ice::Long timestamp;
+    IceMX::MetricsView view = metrics->getMetricsView("View", timestamp, Ice::emptyCurrent);
+    test(view["BufferPool"].size() == 1);
+
+    //
+    // Marshal the metrics and read them back as Test::BufferPoolMetrics.
+    //
+    vector<Ice::Byte> data;
+    Ice::OutputStream out(communicator);
+    out.write(view["BufferPool"][0]);
+    out.writePendingValues();
+    out.finished(data);
+    Ice::InputStream in(communicator, data);
+    BufferPoolMetricsPtr m;
+    in.read(m);
+    in.readPendingValues();
+    test(m && m->id == "BufferPool" && m->current == 1 && m->total == 1);
+    return m;
+}
+
+Ice::CommunicatorPtr
+createCommunicator(const Ice::CommunicatorPtr& communicator, const string& poolSize)
+{
+    Ice::InitializationData initData;
+    initData.properties = communicator->getProperties()->clone();
+    initData.properties->setProperty("Ice.Admin.Enabled", "1");
+    initData.properties->setProperty("IceMX.Metrics.View.GroupBy", "id");
+    initData.properties->setProperty("Ice.BufferPool.Size", poolSize);
+    Ice::CommunicatorPtr c = Ice::initialize(initData);
+#ifdef ICE_CPP11_MAPPING
+    c->getValueFactoryManager()->add([](const string&) { return make_shared<BufferPoolMetrics>(); },
+                                     "::IceMX::BufferPoolMetrics");
+#else
+    c->getValueFactoryManager()->add(new BufferPoolMetricsFactory, "::IceMX::BufferPoolMetrics");
+#endif
+    return c;
+}
+
+}
+
 int
 run(int, char**, const Ice::CommunicatorPtr& communicator)
 {
@@ -1334,6 +1454,45 @@ run(int, char**, const Ice::CommunicatorPtr& communicator)
     }
 
     cout << "ok" << endl;
+
+    cout << "testing buffer pool... " << flush;
+    {
+        Ice::CommunicatorPtr comm1 = createCommunicator(communicator, "64");
+        BufferPoolMetricsPtr m1 = getBufferPoolMetrics(comm1);
+
+        //
+        // The buffers released by this thread are reused from its cache.
+        //
+        marshalSequences(comm1);
+        BufferPoolMetricsPtr m2 = getBufferPoolMetrics(comm1);
+        test(m2->allocations > m1->allocations);
+        test(m2->hits > m1->hits && m2->hits <= m2->allocations);
+
+        //
+        // The statistics of the threads are collected when they exit and
+        // the shared pool doesn't exceed the size set by the communicator.
+        //
+        marshalSequencesWithThreads(comm1);
+        BufferPoolMetricsPtr m3 = getBufferPoolMetrics(comm1);
+        test(m3->allocations > m2->allocations);
+        test(m3->cachedBytes <= 64 * 1024);
+
+        //
+        // The pool uses the largest size set by the communicators until
+        // the communicator which sets it is destroyed.
+        //
+        Ice::CommunicatorPtr comm2 = createCommunicator(communicator, "8192");
+        marshalSequencesWithThreads(comm2);
+        BufferPoolMetricsPtr m4 = getBufferPoolMetrics(comm1);
+        test(m4->cachedBytes > 64 * 1024);
+        comm2->destroy();
+        BufferPoolMetricsPtr m5 = getBufferPoolMetrics(comm1);
+        test(m5->cachedBytes <= 64 * 1024);
+
+        comm1->destroy();
+    }
+    cout << "ok" << endl;
+
     return 0;
 }
 
@@ -0,0 +1,75 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <IceUtil/StringUtil.h>
+#include <TestCommon.h>
+#include <Test.h>
+
+using namespace std;
+using namespace Test;
+
+TestIntfPrxPtr
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    string ref = "test:" + getTestEndpoint(communicator, 0);
+    TestIntfPrxPtr obj = ICE_CHECKED_CAST(TestIntfPrx, communicator->stringToProxy(ref));
+    test(obj);
+
+    cout << "testing reactors... " << flush;
+    {
+        //
+        // Each connection is assigned to one of the two reactors of the
+        // server thread pool in turn and all its requests are dispatched
+        // by the thread of this reactor.
+        //
+        vector<string> threads;
+        for(int i = 0; i < 6; ++i)
+        {
+            ostringstream os;
+            os << "reactor-" << i;
+            TestIntfPrxPtr prx = obj->ice_connectionId(os.str());
+            string thread = prx->getThreadId();
+            for(int j = 0; j < 5; ++j)
+            {
+                test(prx->getThreadId() == thread);
+            }
+            threads.push_back(thread);
+        }
+        test(threads[0] != threads[1]);
+        for(size_t i = 2; i < threads.size(); ++i)
+        {
+            test(threads[i] == threads[i - 2]);
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing thread affinity... " << flush;
+    {
+        //
+        // The threads of an adapter's thread pool are bound to the CPUs
+        // of its ThreadAffinity property. The CPUs of the threads of the
+        // test adapter, which aren't bound, are all the CPUs the server
+        // can use.
+        //
+        string all = obj->getThreadAffinity();
+        if(!all.empty())
+        {
+            vector<string> cpus;
+            IceUtilInternal::splitString(all, ",", cpus);
+            test(!cpus.empty());
+            test(obj->createAffinityAdapter(cpus.front())->getThreadAffinity() == cpus.front());
+            test(obj->createAffinityAdapter(cpus.back())->getThreadAffinity() == cpus.back());
+            test(obj->createAffinityAdapter(all)->getThreadAffinity() == all);
+        }
+    }
+    cout << "ok" << endl;
+
+    return obj;
+}
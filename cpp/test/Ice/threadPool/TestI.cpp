@@ -0,0 +1,76 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <IceUtil/UUID.h>
+#include <TestCommon.h>
+#include <TestI.h>
+
+#if defined(__linux__)
+#   include <pthread.h>
+#   include <sched.h>
+#endif
+
+using namespace std;
+
+string
+TestI::getThreadId(const Ice::Current&)
+{
+    ostringstream os;
+    os << IceUtil::ThreadControl().id();
+    return os.str();
+}
+
+string
+TestI::getThreadAffinity(const Ice::Current&)
+{
+    //
+    // Returns the CPUs of the dispatch thread, or an empty string if
+    // the thread affinity isn't available on this platform.
+    //
+    ostringstream os;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    test(pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0);
+    bool first = true;
+    for(int i = 0; i < CPU_SETSIZE; ++i)
+    {
+        if(CPU_ISSET(i, &set))
+        {
+            if(!first)
+            {
+                os << ',';
+            }
+            os << i;
+            first = false;
+        }
+    }
+#endif
+    return os.str();
+}
+
+Test::TestIntfPrxPtr
+TestI::createAffinityAdapter(ICE_IN(string) cpus, const Ice::Current& current)
+{
+    Ice::CommunicatorPtr communicator = current.adapter->getCommunicator();
+    string name = IceUtil::generateUUID();
+    communicator->getProperties()->setProperty(name + ".ThreadPool.Size", "1");
+    communicator->getProperties()->setProperty(name + ".ThreadPool.ThreadAffinity", cpus);
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints(name, "default");
+    Ice::ObjectPrxPtr prx = adapter->add(ICE_MAKE_SHARED(TestI), Ice::stringToIdentity("test"));
+    adapter->activate();
+    return ICE_UNCHECKED_CAST(Test::TestIntfPrx, prx);
+}
+
+void
+TestI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
@@ -0,0 +1,28 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include <Test.h>
+
+class TestI : public Test::TestIntf
+{
+public:
+
+    virtual std::string getThreadId(const Ice::Current&);
+
+    virtual std::string getThreadAffinity(const Ice::Current&);
+
+    virtual Test::TestIntfPrxPtr createAffinityAdapter(ICE_IN(std::string), const Ice::Current&);
+
+    virtual void shutdown(const Ice::Current&);
+};
+
+#endif
@@ -134,6 +134,58 @@ allTests(const CommunicatorPtr& communicator)
 
     cout << "ok" << endl;
 
+    cout << "testing udp batching... " << flush;
+    {
+        try
+        {
+            communicator->stringToProxy("test:udp -p 12010 --batch 0");
+            test(false);
+        }
+        catch(const Ice::EndpointParseException&)
+        {
+        }
+        try
+        {
+            communicator->stringToProxy("test:udp -p 12010 --batch 1025");
+            test(false);
+        }
+        catch(const Ice::EndpointParseException&)
+        {
+        }
+        test(communicator->proxyToString(communicator->stringToProxy("test:udp -p 12010 --batch 1024")).find(
+                 "--batch 1024") != string::npos);
+
+        communicator->getProperties()->setProperty("BatchReplyAdapter.Endpoints", "udp --batch 16");
+        Ice::ObjectAdapterPtr batchAdapter = communicator->createObjectAdapter("BatchReplyAdapter");
+        PingReplyIPtr batchReplyI = ICE_MAKE_SHARED(PingReplyI);
+        PingReplyPrxPtr batchReply =
+            ICE_UNCHECKED_CAST(PingReplyPrx, batchAdapter->addWithUUID(batchReplyI))->ice_datagram();
+        test(communicator->proxyToString(batchReply).find("--batch 16") != string::npos);
+        batchAdapter->activate();
+
+        TestIntfPrxPtr batchObj = ICE_UNCHECKED_CAST(TestIntfPrx,
+            communicator->stringToProxy("test -d:" + getTestEndpoint(communicator, 0, "udp") + " --batch 16"));
+        nRetry = 5;
+        while(nRetry-- > 0)
+        {
+            batchReplyI->reset();
+            for(int i = 0; i < 10; ++i)
+            {
+                batchObj->ping(batchReply);
+            }
+            ret = batchReplyI->waitReply(10, IceUtil::Time::seconds(2));
+            if(ret)
+            {
+                break; // Success
+            }
+            batchReplyI = ICE_MAKE_SHARED(PingReplyI);
+            batchReply = ICE_UNCHECKED_CAST(PingReplyPrx, batchAdapter->addWithUUID(batchReplyI))->ice_datagram();
+        }
+        test(ret);
+        batchAdapter->destroy();
+    }
+    cout << "ok" << endl;
+
     ostringstream endpoint;
     if(communicator->getProperties()->getProperty("Ice.IPv6") == "1")
     {
@@ -0,0 +1,176 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <IceUtil/Thread.h>
+#include <TestCommon.h>
+#include <Test.h>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+
+class TestIntfI : public virtual TestIntf
+{
+public:
+
+#ifdef ICE_CPP11_MAPPING
+    virtual Ice::ByteSeq
+    echo(Ice::ByteSeq seq, const Ice::Current&)
+#else
+    virtual Ice::ByteSeq
+    echo(const Ice::ByteSeq& seq, const Ice::Current&)
+#endif
+    {
+        return seq;
+    }
+};
+
+class EchoThread : public IceUtil::Thread
+{
+public:
+
+    EchoThread(const TestIntfPrxPtr& prx, const Ice::ByteSeq& seq) : _prx(prx), _seq(seq), _failed(false)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        try
+        {
+            _result = _prx->echo(_seq);
+        }
+        catch(const Ice::LocalException& ex)
+        {
+            cerr << ex << endl;
+            _failed = true;
+        }
+    }
+
+    bool
+    succeeded() const
+    {
+        return !_failed && _result == _seq;
+    }
+
+private:
+
+    const TestIntfPrxPtr _prx;
+    const Ice::ByteSeq& _seq;
+    Ice::ByteSeq _result;
+    bool _failed;
+};
+typedef IceUtil::Handle<EchoThread> EchoThreadPtr;
+
+Ice::ByteSeq
+createPayload(size_t size)
+{
+    Ice::ByteSeq seq(size);
+    unsigned int seed = static_cast<unsigned int>(size);
+    for(Ice::ByteSeq::iterator p = seq.begin(); p != seq.end(); ++p)
+    {
+        seed = seed * 1103515245 + 12345;
+        *p = static_cast<Ice::Byte>(seed >> 16);
+    }
+    return seq;
+}
+
+}
+
+void
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    //
+    // The payload of the frames sent by ws clients is masked in place by
+    // windows of 256KB. The server doesn't read from the connection while
+    // its adapter is held, the small socket buffers can only hold the
+    // start of the request.
+    //
+    const string endpoint = getTestEndpoint(communicator, 0, "ws");
+
+    Ice::InitializationData initData;
+    initData.properties = communicator->getProperties()->clone();
+    initData.properties->setProperty("Ice.TCP.RcvSize", "65536");
+    initData.properties->setProperty("Ice.MessageSizeMax", "16384");
+    initData.properties->setProperty("Ice.Warn.Connections", "0");
+    initData.properties->setProperty("TestAdapter.Endpoints", endpoint);
+    Ice::CommunicatorPtr server = Ice::initialize(initData);
+    Ice::ObjectAdapterPtr adapter = server->createObjectAdapter("TestAdapter");
+    adapter->add(ICE_MAKE_SHARED(TestIntfI), Ice::stringToIdentity("test"));
+    adapter->activate();
+
+    initData.properties = communicator->getProperties()->clone();
+    initData.properties->setProperty("Ice.TCP.SndSize", "65536");
+    initData.properties->setProperty("Ice.MessageSizeMax", "16384");
+    initData.properties->setProperty("Ice.RetryIntervals", "2000");
+    initData.properties->setProperty("Ice.Warn.Connections", "0");
+    Ice::CommunicatorPtr client = Ice::initialize(initData);
+    TestIntfPrxPtr prx = ICE_UNCHECKED_CAST(TestIntfPrx, client->stringToProxy("test:" + endpoint));
+
+    const size_t window = 256 * 1024;
+
+    cout << "testing payloads spanning several masking windows... " << flush;
+    {
+        const size_t sizes[] = { 1, 7, window - 1, window + 3, 3 * window + 5, 4 * window - 2 };
+        for(size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+        {
+            Ice::ByteSeq seq = createPayload(sizes[i]);
+            test(prx->echo(seq) == seq);
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing partially written payloads... " << flush;
+    {
+        //
+        // The request is written by several calls while the server
+        // doesn't read, the write stops and resumes in the middle of
+        // the masking windows.
+        //
+        Ice::ByteSeq seq = createPayload(8 * 1024 * 1024 + 3);
+        prx->ice_ping();
+        adapter->hold();
+        adapter->waitForHold();
+        EchoThreadPtr thread = new EchoThread(prx, seq);
+        IceUtil::ThreadControl control = thread->start();
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+        adapter->activate();
+        control.join();
+        test(thread->succeeded());
+    }
+    cout << "ok" << endl;
+
+    cout << "testing retry of partially written payloads... " << flush;
+    {
+        //
+        // The write times out while a masking window is partially
+        // written. The connection returns the request to the invocation
+        // which retries it on a new connection once the adapter is
+        // activated, the payload must be sent unmasked again.
+        //
+        TestIntfPrxPtr timeoutPrx = prx->ice_timeout(500);
+        Ice::ByteSeq seq = createPayload(8 * 1024 * 1024 + 3);
+        timeoutPrx->ice_ping();
+        adapter->hold();
+        adapter->waitForHold();
+        EchoThreadPtr thread = new EchoThread(timeoutPrx, seq);
+        IceUtil::ThreadControl control = thread->start();
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1000));
+        adapter->activate();
+        control.join();
+        test(thread->succeeded());
+    }
+    cout << "ok" << endl;
+
+    client->destroy();
+    server->destroy();
+}
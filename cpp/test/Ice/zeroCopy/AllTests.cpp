@@ -0,0 +1,167 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <IceUtil/Thread.h>
+#include <TestCommon.h>
+#include <Test.h>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+
+class TestIntfI : public virtual TestIntf, private IceUtil::Mutex
+{
+public:
+
+    TestIntfI() : _lastSum(0)
+    {
+    }
+
+#ifdef ICE_CPP11_MAPPING
+    virtual Ice::Long
+    sum(Ice::ByteSeq seq, const Ice::Current&)
+#else
+    virtual Ice::Long
+    sum(const Ice::ByteSeq& seq, const Ice::Current&)
+#endif
+    {
+        Ice::Long s = 0;
+        for(Ice::ByteSeq::const_iterator p = seq.begin(); p != seq.end(); ++p)
+        {
+            s += *p;
+        }
+        Lock sync(*this);
+        _lastSum = s;
+        return s;
+    }
+
+    virtual Ice::Long
+    lastSum(const Ice::Current&)
+    {
+        Lock sync(*this);
+        return _lastSum;
+    }
+
+private:
+
+    Ice::Long _lastSum;
+};
+
+class SumThread : public IceUtil::Thread
+{
+public:
+
+    SumThread(const TestIntfPrxPtr& prx, const Ice::ByteSeq& seq) : _prx(prx), _seq(seq), _sum(-1)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        _sum = _prx->sum(_seq);
+    }
+
+    Ice::Long
+    sum() const
+    {
+        return _sum;
+    }
+
+private:
+
+    const TestIntfPrxPtr _prx;
+    const Ice::ByteSeq& _seq;
+    Ice::Long _sum;
+};
+typedef IceUtil::Handle<SumThread> SumThreadPtr;
+
+}
+
+void
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    //
+    // The server doesn't read from the connection while its adapter is
+    // held, the small socket buffers can only hold the start of the
+    // request.
+    //
+    const string endpoint = getTestEndpoint(communicator, 0, "tcp");
+
+    Ice::InitializationData initData;
+    initData.properties = communicator->getProperties()->clone();
+    initData.properties->setProperty("Ice.TCP.RcvSize", "65536");
+    initData.properties->setProperty("Ice.MessageSizeMax", "16384");
+    initData.properties->setProperty("TestAdapter.Endpoints", endpoint);
+    Ice::CommunicatorPtr server = Ice::initialize(initData);
+    Ice::ObjectAdapterPtr adapter = server->createObjectAdapter("TestAdapter");
+    adapter->add(ICE_MAKE_SHARED(TestIntfI), Ice::stringToIdentity("test"));
+    adapter->activate();
+
+    initData.properties = communicator->getProperties()->clone();
+    initData.properties->setProperty("Ice.ZeroCopySize", "1");
+    initData.properties->setProperty("Ice.TCP.SndSize", "65536");
+    Ice::CommunicatorPtr client = Ice::initialize(initData);
+    TestIntfPrxPtr prx = ICE_UNCHECKED_CAST(TestIntfPrx, client->stringToProxy("test:" + endpoint));
+
+    const size_t size = 8 * 1024 * 1024;
+    const size_t tail = 4 * 1024 * 1024;
+
+    cout << "testing byte sequences larger than the send buffer... " << flush;
+    {
+        Ice::ByteSeq seq(size, 1);
+        test(prx->sum(seq) == static_cast<Ice::Long>(size));
+
+        //
+        // The request is sent from the caller's memory until it's fully
+        // written: the bytes changed while the write waits for the server
+        // are the bytes received by the server.
+        //
+        adapter->hold();
+        adapter->waitForHold();
+        SumThreadPtr thread = new SumThread(prx, seq);
+        IceUtil::ThreadControl control = thread->start();
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+        fill(seq.end() - tail, seq.end(), Ice::Byte(2));
+        adapter->activate();
+        control.join();
+        test(thread->sum() == static_cast<Ice::Long>(size + tail));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing canceled requests... " << flush;
+    {
+        //
+        // The byte sequences are copied when the invocation times out
+        // while the request is being written, the server receives the
+        // bytes of the sequence when it was canceled.
+        //
+        Ice::ByteSeq* seq = new Ice::ByteSeq(size, 1);
+        adapter->hold();
+        adapter->waitForHold();
+        try
+        {
+            prx->ice_invocationTimeout(500)->sum(*seq);
+            test(false);
+        }
+        catch(const Ice::InvocationTimeoutException&)
+        {
+        }
+        fill(seq->begin(), seq->end(), Ice::Byte(2));
+        delete seq;
+        adapter->activate();
+        test(prx->lastSum() == static_cast<Ice::Long>(size));
+    }
+    cout << "ok" << endl;
+
+    client->destroy();
+    server->destroy();
+}
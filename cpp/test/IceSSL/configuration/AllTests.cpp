@@ -58,6 +58,10 @@ using namespace Windows::Security::Cryptography::Certificates;
 #  include <IceSSL/OpenSSL.h>
 #endif
 
+#ifdef ICE_USE_OPENSSL
+#  include <openssl/ssl.h> // For the kernel TLS macros
+#endif
+
 using namespace std;
 using namespace Ice;
 
@@ -79,6 +83,61 @@ toHexString(vector<Ice::Byte> data)
     return os.str();
 }
 
+class WarningLoggerI : public Ice::Logger,
+                       private IceUtil::Mutex
+#ifdef ICE_CPP11_MAPPING
+                     , public std::enable_shared_from_this<WarningLoggerI>
+#endif
+{
+public:
+
+    virtual void
+    print(const string&)
+    {
+    }
+
+    virtual void
+    trace(const string&, const string&)
+    {
+    }
+
+    virtual void
+    warning(const string& message)
+    {
+        Lock sync(*this);
+        _warnings.push_back(message);
+    }
+
+    virtual void
+    error(const string&)
+    {
+    }
+
+    virtual string
+    getPrefix()
+    {
+        return "";
+    }
+
+    virtual Ice::LoggerPtr
+    cloneWithPrefix(const string&)
+    {
+        return ICE_SHARED_FROM_THIS;
+    }
+
+    vector<string>
+    getWarnings()
+    {
+        Lock sync(*this);
+        return _warnings;
+    }
+
+private:
+
+    vector<string> _warnings;
+};
+ICE_DEFINE_PTR(WarningLoggerIPtr, WarningLoggerI);
+
 void
 readFile(const string& file, vector<char>& buffer)
 {
@@ -812,6 +871,220 @@ allTests(const CommunicatorPtr& communicator, const string& testDir, bool p12)
 #endif
     cout << "ok" << endl;
 
+#ifdef ICE_USE_OPENSSL
+    cout << "testing session resumption... " << flush;
+    {
+        InitializationData initData;
+        initData.properties = createClientProps(defaultProps, p12, "", "");
+        initData.properties->setProperty("IceSSL.VerifyPeer", "0");
+        initData.properties->setProperty("IceSSL.SessionCache", "1");
+        CommunicatorPtr comm = initialize(initData);
+        IceSSL::OpenSSL::SessionCacheStats* stats =
+            dynamic_cast<IceSSL::OpenSSL::SessionCacheStats*>(comm->getPluginManager()->getPlugin("IceSSL").get());
+        test(stats);
+        Test::ServerFactoryPrxPtr fact = ICE_CHECKED_CAST(Test::ServerFactoryPrx, comm->stringToProxy(factoryRef));
+        test(fact);
+
+        Test::Properties d = createServerProps(defaultProps, p12, "s_rsa_ca1", "");
+        d["IceSSL.VerifyPeer"] = "0";
+        d["IceSSL.SessionCache"] = "1";
+        Test::ServerPrxPtr server = fact->createServer(d);
+        try
+        {
+            server->noCert();
+            test(stats->getSessionCacheHits() == 0 && stats->getSessionCacheMisses() == 1);
+            server->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+
+            //
+            // The new connection resumes the session of the first one.
+            //
+            server->noCert();
+            test(stats->getSessionCacheHits() == 1 && stats->getSessionCacheMisses() == 1);
+        }
+        catch(const LocalException& ex)
+        {
+            cerr << ex << endl;
+            test(false);
+        }
+        fact->destroyServer(server);
+        comm->destroy();
+    }
+    {
+        //
+        // The peer certificates of resumed sessions are checked like those
+        // of new sessions, with the same chain.
+        //
+        InitializationData initData;
+        initData.properties = createClientProps(defaultProps, p12, "c_rsa_ca1", "cacert1");
+        initData.properties->setProperty("IceSSL.SessionCache", "1");
+        initData.properties->setProperty("IceSSL.TrustOnly.Client", "C=US, ST=Florida, O=ZeroC\\, Inc.,"
+                                         "OU=Ice, emailAddress=info@zeroc.com, CN=Server");
+        CommunicatorPtr comm = initialize(initData);
+        IceSSL::OpenSSL::SessionCacheStats* stats =
+            dynamic_cast<IceSSL::OpenSSL::SessionCacheStats*>(comm->getPluginManager()->getPlugin("IceSSL").get());
+        test(stats);
+        Test::ServerFactoryPrxPtr fact = ICE_CHECKED_CAST(Test::ServerFactoryPrx, comm->stringToProxy(factoryRef));
+        test(fact);
+
+        Test::Properties d = createServerProps(defaultProps, p12, "s_rsa_ca1", "cacert1");
+        d["IceSSL.VerifyPeer"] = "2";
+        d["IceSSL.SessionCache"] = "1";
+        d["IceSSL.TrustOnly.Server"] = "C=US, ST=Florida, O=ZeroC\\, Inc., OU=Ice, emailAddress=info@zeroc.com,"
+                                       "CN=Client";
+        Test::ServerPrxPtr server = fact->createServer(d);
+        try
+        {
+#  if defined(_WIN32)
+            IceSSL::CertificatePtr clientCert = IceSSL::OpenSSL::Certificate::load(defaultDir + "/c_rsa_ca1_pub.pem");
+            IceSSL::CertificatePtr serverCert = IceSSL::OpenSSL::Certificate::load(defaultDir + "/s_rsa_ca1_pub.pem");
+#  else
+            IceSSL::CertificatePtr clientCert = IceSSL::Certificate::load(defaultDir + "/c_rsa_ca1_pub.pem");
+            IceSSL::CertificatePtr serverCert = IceSSL::Certificate::load(defaultDir + "/s_rsa_ca1_pub.pem");
+#  endif
+            for(int i = 0; i < 2; ++i)
+            {
+                server->checkCert(clientCert->getSubjectDN(), clientCert->getIssuerDN());
+                IceSSL::ConnectionInfoPtr info =
+                    ICE_DYNAMIC_CAST(IceSSL::ConnectionInfo, server->ice_getConnection()->getInfo());
+                test(info->verified);
+                test(info->certs.size() == 2);
+                test(info->certs[0]->getSubjectDN() == serverCert->getSubjectDN());
+                server->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+            }
+            test(stats->getSessionCacheHits() == 1 && stats->getSessionCacheMisses() == 1);
+        }
+        catch(const LocalException& ex)
+        {
+            cerr << ex << endl;
+            test(false);
+        }
+        fact->destroyServer(server);
+        comm->destroy();
+    }
+#  if OPENSSL_VERSION_NUMBER >= 0x10100000L // ticketkeys.bin contains 80 bytes of keys
+    {
+        //
+        // A session established with an object adapter isn't resumed by
+        // another adapter, even when the client offers it to the same
+        // address and the servers share the session ticket keys.
+        //
+        InitializationData initData;
+        initData.properties = createClientProps(defaultProps, p12, "", "");
+        initData.properties->setProperty("IceSSL.VerifyPeer", "0");
+        initData.properties->setProperty("IceSSL.SessionCache", "1");
+        CommunicatorPtr comm = initialize(initData);
+        IceSSL::OpenSSL::SessionCacheStats* stats =
+            dynamic_cast<IceSSL::OpenSSL::SessionCacheStats*>(comm->getPluginManager()->getPlugin("IceSSL").get());
+        test(stats);
+        Test::ServerFactoryPrxPtr fact = ICE_CHECKED_CAST(Test::ServerFactoryPrx, comm->stringToProxy(factoryRef));
+        test(fact);
+
+        Test::Properties d = createServerProps(defaultProps, p12, "s_rsa_ca1", "");
+        d["IceSSL.VerifyPeer"] = "0";
+        d["IceSSL.SessionCache"] = "1";
+        d["IceSSL.SessionTicketKeys"] = "ticketkeys.bin";
+        Test::ServerPrxPtr server = fact->createServer(d);
+        try
+        {
+            server->noCert();
+            Ice::IPConnectionInfoPtr info =
+                ICE_DYNAMIC_CAST(Ice::IPConnectionInfo, server->ice_getConnection()->getInfo()->underlying);
+            test(info);
+            ostringstream os;
+            os << "ssl -p " << info->remotePort;
+            d["Test.Endpoints"] = os.str();
+        }
+        catch(const LocalException& ex)
+        {
+            cerr << ex << endl;
+            test(false);
+        }
+        fact->destroyServer(server);
+
+        //
+        // The session is resumed by a new server with the same adapter name.
+        //
+        server = fact->createServer(d);
+        try
+        {
+            server->noCert();
+            test(stats->getSessionCacheHits() == 1 && stats->getSessionCacheMisses() == 1);
+        }
+        catch(const LocalException& ex)
+        {
+            cerr << ex << endl;
+            test(false);
+        }
+        fact->destroyServer(server);
+
+        d["Test.AdapterName"] = "OtherAdapter";
+        server = fact->createServer(d);
+        try
+        {
+            server->noCert();
+            test(stats->getSessionCacheHits() == 1 && stats->getSessionCacheMisses() == 2);
+        }
+        catch(const LocalException& ex)
+        {
+            cerr << ex << endl;
+            test(false);
+        }
+        fact->destroyServer(server);
+        comm->destroy();
+    }
+#  endif
+    cout << "ok" << endl;
+#endif
+
+#ifdef ICE_USE_OPENSSL
+    cout << "testing kernel TLS... " << flush;
+    {
+        //
+        // With IceSSL.KernelTLS, the records are encrypted by the kernel if
+        // OpenSSL, the kernel and the cipher support it. Otherwise, the
+        // connections keep using the OpenSSL record layer. A warning is
+        // logged if OpenSSL is built without kernel TLS.
+        //
+        WarningLoggerIPtr logger = ICE_MAKE_SHARED(WarningLoggerI);
+        InitializationData initData;
+        initData.properties = createClientProps(defaultProps, p12, "", "");
+        initData.properties->setProperty("IceSSL.VerifyPeer", "0");
+        initData.properties->setProperty("IceSSL.KernelTLS", "1");
+        initData.logger = logger;
+        CommunicatorPtr comm = initialize(initData);
+        vector<string> warnings = logger->getWarnings();
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+        test(warnings.empty());
+#else
+        test(warnings.size() == 1 && warnings[0].find("IceSSL.KernelTLS is not supported") != string::npos);
+#endif
+        Test::ServerFactoryPrxPtr fact = ICE_CHECKED_CAST(Test::ServerFactoryPrx, comm->stringToProxy(factoryRef));
+        test(fact);
+
+        Test::Properties d = createServerProps(defaultProps, p12, "s_rsa_ca1", "");
+        d["IceSSL.VerifyPeer"] = "0";
+        d["IceSSL.KernelTLS"] = "1";
+        Test::ServerPrxPtr server = fact->createServer(d);
+        try
+        {
+            for(int i = 0; i < 10; ++i)
+            {
+                server->noCert();
+            }
+            server->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+            server->noCert();
+        }
+        catch(const LocalException& ex)
+        {
+            cerr << ex << endl;
+            test(false);
+        }
+        fact->destroyServer(server);
+        comm->destroy();
+    }
+    cout << "ok" << endl;
+#endif
+
     cout << "testing certificate verification... " << flush;
     {
         Test::Properties d;
@@ -102,8 +102,15 @@ ServerFactoryI::createServer(ICE_IN(Test::Properties) props, const Current&)
     }
     initData.properties->setProperty("IceSSL.DefaultDir", _defaultDir);
 
+    //
+    // The session resumption tests create servers with other adapter names
+    // and reuse the port of a previous server.
+    //
+    string adapterName = initData.properties->getPropertyWithDefault("Test.AdapterName", "ServerAdapter");
+    string endpoints = initData.properties->getPropertyWithDefault("Test.Endpoints", "ssl");
+
     CommunicatorPtr communicator = initialize(initData);
-    ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints("ServerAdapter", "ssl");
+    ObjectAdapterPtr adapter = communicator->createObjectAdapterWithEndpoints(adapterName, endpoints);
     ServerIPtr server = ICE_MAKE_SHARED(ServerI, communicator);
     ObjectPrxPtr obj = adapter->addWithUUID(server);
     _servers[obj->ice_getIdentity()] = server;
@@ -242,6 +242,109 @@ int main(int, char**)
     }
     cout << "ok" << endl;
 
+    cout << "testing timer wheel... " << flush;
+    {
+        IceUtil::TimerPtr timer = new IceUtil::Timer();
+
+        {
+            //
+            // The timer keeps its tasks in a timing wheel with a tick of one
+            // millisecond and turns of 256 ticks for the first level. Tasks
+            // scheduled around the turns are moved down to the first level
+            // and still run in order, never before their time.
+            //
+            vector<TestTaskPtr> tasks;
+            const int delays[] = { 0, 1, 2, 254, 255, 256, 257, 258, 511, 512, 513, 700 };
+            IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            for(size_t i = 0; i < sizeof(delays) / sizeof(delays[0]); ++i)
+            {
+                tasks.push_back(ICE_MAKE_SHARED(TestTask, IceUtil::Time::milliSeconds(delays[i])));
+                timer->schedule(tasks.back(), tasks.back()->getScheduledTime());
+            }
+
+            vector<TestTaskPtr>::const_iterator p;
+            for(p = tasks.begin(); p != tasks.end(); ++p)
+            {
+                (*p)->waitForRun();
+                test((*p)->getRunTime() >= start + (*p)->getScheduledTime());
+                test((*p)->getCount() == 1);
+            }
+            for(p = tasks.begin(); p + 1 != tasks.end(); ++p)
+            {
+                test((*p)->getRunTime() <= (*(p + 1))->getRunTime());
+            }
+        }
+
+        {
+            //
+            // Cancel a task which shares its slot with tasks that run, and a
+            // task which is moved down to the first level when it's canceled.
+            //
+            TestTaskPtr task1 = ICE_MAKE_SHARED(TestTask);
+            TestTaskPtr task2 = ICE_MAKE_SHARED(TestTask);
+            TestTaskPtr task3 = ICE_MAKE_SHARED(TestTask);
+            TestTaskPtr task4 = ICE_MAKE_SHARED(TestTask);
+            TestTaskPtr task5 = ICE_MAKE_SHARED(TestTask);
+            timer->schedule(task1, IceUtil::Time::milliSeconds(100));
+            timer->schedule(task2, IceUtil::Time::milliSeconds(100));
+            timer->schedule(task3, IceUtil::Time::milliSeconds(100));
+            timer->schedule(task4, IceUtil::Time::milliSeconds(800));
+            timer->schedule(task5, IceUtil::Time::milliSeconds(900));
+            test(timer->cancel(task2));
+            test(!timer->cancel(task2));
+            task1->waitForRun();
+            task3->waitForRun();
+
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(450));
+            test(!task4->hasRun());
+            test(timer->cancel(task4));
+            task5->waitForRun();
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+            test(!task2->hasRun() && !task4->hasRun());
+            test(!timer->cancel(task1) && !timer->cancel(task4));
+        }
+
+        {
+            //
+            // Tasks scheduled far in the future, beyond the span of the wheel,
+            // don't delay the other tasks.
+            //
+            TestTaskPtr task1 = ICE_MAKE_SHARED(TestTask);
+            TestTaskPtr task2 = ICE_MAKE_SHARED(TestTask);
+            TestTaskPtr task3 = ICE_MAKE_SHARED(TestTask);
+            timer->schedule(task1, IceUtil::Time::seconds(100 * 24 * 3600));
+            timer->schedule(task2, IceUtil::Time::seconds(3 * 3600));
+            timer->schedule(task3, IceUtil::Time::milliSeconds(300));
+            task3->waitForRun();
+            test(!task1->hasRun() && !task2->hasRun());
+            test(timer->cancel(task1));
+            test(timer->cancel(task2));
+        }
+
+        {
+            //
+            // A canceled repeated task doesn't run again and can be
+            // scheduled again.
+            //
+            TestTaskPtr task = ICE_MAKE_SHARED(TestTask);
+            timer->scheduleRepeated(task, IceUtil::Time::milliSeconds(10));
+            task->waitForRun();
+            test(timer->cancel(task));
+            int count = task->getCount();
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+            test(count == task->getCount() || count + 1 == task->getCount());
+            test(!timer->cancel(task));
+
+            task->clear();
+            timer->schedule(task, IceUtil::Time::milliSeconds(10));
+            task->waitForRun();
+            test(task->getCount() == 1);
+        }
+
+        timer->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing timer destroy... " << flush;
     {
         {
@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Tue May 16 17:04:55 2017
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Sat Oct 17 14:20:37 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -63,10 +63,17 @@ public final class PropertyNames
         new Property("Ice\\.Admin\\.ThreadPool\\.SizeMax", false, null),
         new Property("Ice\\.Admin\\.ThreadPool\\.SizeWarn", false, null),
         new Property("Ice\\.Admin\\.ThreadPool\\.StackSize", false, null),
+        new Property("Ice\\.Admin\\.ThreadPool\\.Reactors", false, null),
+        new Property("Ice\\.Admin\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("Ice\\.Admin\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("Ice\\.Admin\\.ThreadPool\\.Serialize", false, null),
         new Property("Ice\\.Admin\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("Ice\\.Admin\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("Ice\\.Admin\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("Ice\\.Admin\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("Ice\\.Admin\\.MessageSizeMax", false, null),
+        new Property("Ice\\.Admin\\.DispatchDeadline", false, null),
+        new Property("Ice\\.Admin\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("Ice\\.Admin\\.DelayCreation", false, null),
         new Property("Ice\\.Admin\\.Enabled", false, null),
         new Property("Ice\\.Admin\\.Facets", false, null),
@@ -77,13 +84,21 @@ public final class PropertyNames
         new Property("Ice\\.Admin\\.ServerId", false, null),
         new Property("Ice\\.BackgroundLocatorCacheUpdates", false, null),
         new Property("Ice\\.BatchAutoFlush", true, null),
+        new Property("Ice\\.BatchAutoFlushDelay", false, null),
         new Property("Ice\\.BatchAutoFlushSize", false, null),
+        new Property("Ice\\.BufferPool\\.Size", false, null),
+        new Property("Ice\\.BufferPool\\.ThreadCacheSize", false, null),
         new Property("Ice\\.ChangeUser", false, null),
         new Property("Ice\\.ClassGraphDepthMax", false, null),
         new Property("Ice\\.ClientAccessPolicyProtocol", false, null),
+        new Property("Ice\\.Compression\\.Adaptive", false, null),
+        new Property("Ice\\.Compression\\.Codec", false, null),
         new Property("Ice\\.Compression\\.Level", false, null),
         new Property("Ice\\.CollectObjects", false, null),
+        new Property("Ice\\.CollocationDirect", false, null),
         new Property("Ice\\.Config", false, null),
+        new Property("Ice\\.ConnectionPool\\.Selection", false, null),
+        new Property("Ice\\.ConnectionPool\\.Size", false, null),
         new Property("Ice\\.ConsoleListener", false, null),
         new Property("Ice\\.Default\\.CollocationOptimized", false, null),
         new Property("Ice\\.Default\\.EncodingVersion", false, null),
@@ -145,6 +160,7 @@ public final class PropertyNames
         new Property("Ice\\.PrintProcessId", false, null),
         new Property("Ice\\.PrintStackTraces", false, null),
         new Property("Ice\\.ProgramName", false, null),
+        new Property("Ice\\.ReadAheadSize", false, null),
         new Property("Ice\\.RetryIntervals", false, null),
         new Property("Ice\\.ServerIdleTime", false, null),
         new Property("Ice\\.SOCKSProxyHost", false, null),
@@ -156,20 +172,32 @@ public final class PropertyNames
         new Property("Ice\\.ThreadPool\\.Client\\.SizeMax", false, null),
         new Property("Ice\\.ThreadPool\\.Client\\.SizeWarn", false, null),
         new Property("Ice\\.ThreadPool\\.Client\\.StackSize", false, null),
+        new Property("Ice\\.ThreadPool\\.Client\\.Reactors", false, null),
+        new Property("Ice\\.ThreadPool\\.Client\\.ExecutorSize", false, null),
+        new Property("Ice\\.ThreadPool\\.Client\\.ExecutorDeadline", false, null),
         new Property("Ice\\.ThreadPool\\.Client\\.Serialize", false, null),
         new Property("Ice\\.ThreadPool\\.Client\\.ThreadIdleTime", false, null),
         new Property("Ice\\.ThreadPool\\.Client\\.ThreadPriority", false, null),
+        new Property("Ice\\.ThreadPool\\.Client\\.ThreadAffinity", false, null),
+        new Property("Ice\\.ThreadPool\\.Client\\.ReactorAffinity", false, null),
         new Property("Ice\\.ThreadPool\\.Server\\.Size", false, null),
         new Property("Ice\\.ThreadPool\\.Server\\.SizeMax", false, null),
         new Property("Ice\\.ThreadPool\\.Server\\.SizeWarn", false, null),
         new Property("Ice\\.ThreadPool\\.Server\\.StackSize", false, null),
+        new Property("Ice\\.ThreadPool\\.Server\\.Reactors", false, null),
+        new Property("Ice\\.ThreadPool\\.Server\\.ExecutorSize", false, null),
+        new Property("Ice\\.ThreadPool\\.Server\\.ExecutorDeadline", false, null),
         new Property("Ice\\.ThreadPool\\.Server\\.Serialize", false, null),
         new Property("Ice\\.ThreadPool\\.Server\\.ThreadIdleTime", false, null),
         new Property("Ice\\.ThreadPool\\.Server\\.ThreadPriority", false, null),
+        new Property("Ice\\.ThreadPool\\.Server\\.ThreadAffinity", false, null),
+        new Property("Ice\\.ThreadPool\\.Server\\.ReactorAffinity", false, null),
         new Property("Ice\\.ThreadPriority", false, null),
+        new Property("Ice\\.ThreadAffinity", false, null),
         new Property("Ice\\.ToStringMode", false, null),
         new Property("Ice\\.Trace\\.Admin\\.Properties", false, null),
         new Property("Ice\\.Trace\\.Admin\\.Logger", false, null),
+        new Property("Ice\\.Trace\\.BufferPool", false, null),
         new Property("Ice\\.Trace\\.Locator", false, null),
         new Property("Ice\\.Trace\\.Network", false, null),
         new Property("Ice\\.Trace\\.Protocol", false, null),
@@ -190,6 +218,7 @@ public final class PropertyNames
         new Property("Ice\\.Warn\\.Endpoints", false, null),
         new Property("Ice\\.Warn\\.UnknownProperties", false, null),
         new Property("Ice\\.Warn\\.UnusedProperties", false, null),
+        new Property("Ice\\.ZeroCopySize", false, null),
         new Property("Ice\\.CacheMessageBuffers", false, null),
         new Property("Ice\\.ThreadInterruptSafe", false, null),
         new Property("Ice\\.Voip", false, null),
@@ -242,10 +271,17 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Multicast\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceDiscovery\\.Multicast\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceDiscovery\\.Multicast\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceDiscovery\\.Multicast\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceDiscovery\\.Multicast\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceDiscovery\\.Multicast\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceDiscovery\\.Multicast\\.ThreadPool\\.Serialize", false, null),
         new Property("IceDiscovery\\.Multicast\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceDiscovery\\.Multicast\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceDiscovery\\.Multicast\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceDiscovery\\.Multicast\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceDiscovery\\.Multicast\\.MessageSizeMax", false, null),
+        new Property("IceDiscovery\\.Multicast\\.DispatchDeadline", false, null),
+        new Property("IceDiscovery\\.Multicast\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceDiscovery\\.Reply\\.ACM\\.Timeout", false, null),
         new Property("IceDiscovery\\.Reply\\.ACM\\.Heartbeat", false, null),
         new Property("IceDiscovery\\.Reply\\.ACM\\.Close", false, null),
@@ -279,10 +315,17 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Reply\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceDiscovery\\.Reply\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceDiscovery\\.Reply\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceDiscovery\\.Reply\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceDiscovery\\.Reply\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceDiscovery\\.Reply\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceDiscovery\\.Reply\\.ThreadPool\\.Serialize", false, null),
         new Property("IceDiscovery\\.Reply\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceDiscovery\\.Reply\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceDiscovery\\.Reply\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceDiscovery\\.Reply\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceDiscovery\\.Reply\\.MessageSizeMax", false, null),
+        new Property("IceDiscovery\\.Reply\\.DispatchDeadline", false, null),
+        new Property("IceDiscovery\\.Reply\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceDiscovery\\.Locator\\.ACM\\.Timeout", false, null),
         new Property("IceDiscovery\\.Locator\\.ACM\\.Heartbeat", false, null),
         new Property("IceDiscovery\\.Locator\\.ACM\\.Close", false, null),
@@ -316,10 +359,17 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Locator\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceDiscovery\\.Locator\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceDiscovery\\.Locator\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceDiscovery\\.Locator\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceDiscovery\\.Locator\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceDiscovery\\.Locator\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceDiscovery\\.Locator\\.ThreadPool\\.Serialize", false, null),
         new Property("IceDiscovery\\.Locator\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceDiscovery\\.Locator\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceDiscovery\\.Locator\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceDiscovery\\.Locator\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceDiscovery\\.Locator\\.MessageSizeMax", false, null),
+        new Property("IceDiscovery\\.Locator\\.DispatchDeadline", false, null),
+        new Property("IceDiscovery\\.Locator\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceDiscovery\\.Lookup", false, null),
         new Property("IceDiscovery\\.Timeout", false, null),
         new Property("IceDiscovery\\.RetryCount", false, null),
@@ -366,10 +416,17 @@ public final class PropertyNames
         new Property("IceLocatorDiscovery\\.Reply\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceLocatorDiscovery\\.Reply\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceLocatorDiscovery\\.Reply\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceLocatorDiscovery\\.Reply\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceLocatorDiscovery\\.Reply\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceLocatorDiscovery\\.Reply\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceLocatorDiscovery\\.Reply\\.ThreadPool\\.Serialize", false, null),
         new Property("IceLocatorDiscovery\\.Reply\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceLocatorDiscovery\\.Reply\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceLocatorDiscovery\\.Reply\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceLocatorDiscovery\\.Reply\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceLocatorDiscovery\\.Reply\\.MessageSizeMax", false, null),
+        new Property("IceLocatorDiscovery\\.Reply\\.DispatchDeadline", false, null),
+        new Property("IceLocatorDiscovery\\.Reply\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceLocatorDiscovery\\.Locator\\.ACM\\.Timeout", false, null),
         new Property("IceLocatorDiscovery\\.Locator\\.ACM\\.Heartbeat", false, null),
         new Property("IceLocatorDiscovery\\.Locator\\.ACM\\.Close", false, null),
@@ -403,10 +460,17 @@ public final class PropertyNames
         new Property("IceLocatorDiscovery\\.Locator\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceLocatorDiscovery\\.Locator\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceLocatorDiscovery\\.Locator\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceLocatorDiscovery\\.Locator\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceLocatorDiscovery\\.Locator\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceLocatorDiscovery\\.Locator\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceLocatorDiscovery\\.Locator\\.ThreadPool\\.Serialize", false, null),
         new Property("IceLocatorDiscovery\\.Locator\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceLocatorDiscovery\\.Locator\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceLocatorDiscovery\\.Locator\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceLocatorDiscovery\\.Locator\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceLocatorDiscovery\\.Locator\\.MessageSizeMax", false, null),
+        new Property("IceLocatorDiscovery\\.Locator\\.DispatchDeadline", false, null),
+        new Property("IceLocatorDiscovery\\.Locator\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceLocatorDiscovery\\.Lookup", false, null),
         new Property("IceLocatorDiscovery\\.Timeout", false, null),
         new Property("IceLocatorDiscovery\\.RetryCount", false, null),
@@ -490,10 +554,17 @@ public final class PropertyNames
         new Property("IceBridge\\.Source\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceBridge\\.Source\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceBridge\\.Source\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceBridge\\.Source\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceBridge\\.Source\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceBridge\\.Source\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceBridge\\.Source\\.ThreadPool\\.Serialize", false, null),
         new Property("IceBridge\\.Source\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceBridge\\.Source\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceBridge\\.Source\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceBridge\\.Source\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceBridge\\.Source\\.MessageSizeMax", false, null),
+        new Property("IceBridge\\.Source\\.DispatchDeadline", false, null),
+        new Property("IceBridge\\.Source\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceBridge\\.Target\\.Endpoints", false, null),
         new Property("IceBridge\\.InstanceName", false, null),
         null
@@ -545,10 +616,17 @@ public final class PropertyNames
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.ThreadPool\\.Serialize", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.MessageSizeMax", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.DispatchDeadline", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Locator\\.ACM\\.Timeout", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Locator\\.ACM\\.Heartbeat", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Locator\\.ACM\\.Close", false, null),
@@ -582,10 +660,17 @@ public final class PropertyNames
         new Property("IceGridAdmin\\.Discovery\\.Locator\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Locator\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Locator\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Locator\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Locator\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Locator\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Locator\\.ThreadPool\\.Serialize", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Locator\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Locator\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Locator\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Locator\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Locator\\.MessageSizeMax", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Locator\\.DispatchDeadline", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Locator\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceGridAdmin\\.Trace\\.Observers", false, null),
         new Property("IceGridAdmin\\.Trace\\.SaveToRegistry", false, null),
         null
@@ -626,10 +711,17 @@ public final class PropertyNames
         new Property("IceGrid\\.AdminRouter\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceGrid\\.AdminRouter\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceGrid\\.AdminRouter\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceGrid\\.AdminRouter\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceGrid\\.AdminRouter\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceGrid\\.AdminRouter\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceGrid\\.AdminRouter\\.ThreadPool\\.Serialize", false, null),
         new Property("IceGrid\\.AdminRouter\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.AdminRouter\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceGrid\\.AdminRouter\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceGrid\\.AdminRouter\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceGrid\\.AdminRouter\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.AdminRouter\\.DispatchDeadline", false, null),
+        new Property("IceGrid\\.AdminRouter\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceGrid\\.InstanceName", false, null),
         new Property("IceGrid\\.Node\\.ACM\\.Timeout", false, null),
         new Property("IceGrid\\.Node\\.ACM\\.Heartbeat", false, null),
@@ -664,10 +756,17 @@ public final class PropertyNames
         new Property("IceGrid\\.Node\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceGrid\\.Node\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceGrid\\.Node\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceGrid\\.Node\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceGrid\\.Node\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceGrid\\.Node\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceGrid\\.Node\\.ThreadPool\\.Serialize", false, null),
         new Property("IceGrid\\.Node\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Node\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceGrid\\.Node\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceGrid\\.Node\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceGrid\\.Node\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Node\\.DispatchDeadline", false, null),
+        new Property("IceGrid\\.Node\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceGrid\\.Node\\.AllowRunningServersAsRoot", false, null),
         new Property("IceGrid\\.Node\\.AllowEndpointsOverride", false, null),
         new Property("IceGrid\\.Node\\.CollocateRegistry", false, null),
@@ -742,10 +841,17 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ThreadPool\\.Serialize", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.DispatchDeadline", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.PreferSecure", false, null),
@@ -789,10 +895,17 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Client\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.ThreadPool\\.Serialize", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.DispatchDeadline", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceGrid\\.Registry\\.CryptPasswords", false, null),
         new Property("IceGrid\\.Registry\\.DefaultTemplates", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.ACM\\.Timeout", false, null),
@@ -828,10 +941,17 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Discovery\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.ThreadPool\\.Serialize", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.DispatchDeadline", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Enabled", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Address", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Port", false, null),
@@ -870,10 +990,17 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Internal\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.ThreadPool\\.Serialize", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.DispatchDeadline", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceGrid\\.Registry\\.LMDB\\.MapSize", false, null),
         new Property("IceGrid\\.Registry\\.LMDB\\.Path", false, null),
         new Property("IceGrid\\.Registry\\.NodeSessionTimeout", false, null),
@@ -924,10 +1051,17 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Server\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.ThreadPool\\.Serialize", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.DispatchDeadline", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceGrid\\.Registry\\.SessionFilters", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.ACM\\.Timeout", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.ACM\\.Heartbeat", false, null),
@@ -962,10 +1096,17 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.SessionManager\\.ThreadPool\\.SizeMax", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.ThreadPool\\.StackSize", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.ThreadPool\\.Reactors", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.ThreadPool\\.Serialize", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.DispatchDeadline", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IceGrid\\.Registry\\.SessionTimeout", false, null),
         new Property("IceGrid\\.Registry\\.SSLPermissionsVerifier\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.SSLPermissionsVerifier\\.ConnectionCached", false, null),
@@ -1029,10 +1170,17 @@ public final class PropertyNames
         new Property("IcePatch2\\.ThreadPool\\.SizeMax", false, null),
         new Property("IcePatch2\\.ThreadPool\\.SizeWarn", false, null),
         new Property("IcePatch2\\.ThreadPool\\.StackSize", false, null),
+        new Property("IcePatch2\\.ThreadPool\\.Reactors", false, null),
+        new Property("IcePatch2\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("IcePatch2\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("IcePatch2\\.ThreadPool\\.Serialize", false, null),
         new Property("IcePatch2\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IcePatch2\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("IcePatch2\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("IcePatch2\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("IcePatch2\\.MessageSizeMax", false, null),
+        new Property("IcePatch2\\.DispatchDeadline", false, null),
+        new Property("IcePatch2\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("IcePatch2\\.Directory", false, null),
         new Property("IcePatch2\\.InstanceName", false, null),
         null
@@ -1068,6 +1216,7 @@ public final class PropertyNames
         new Property("IceSSL\\.FindCert", false, null),
         new Property("IceSSL\\.FindCert\\.[^\\s]+", true, null),
         new Property("IceSSL\\.InitOpenSSL", false, null),
+        new Property("IceSSL\\.KernelTLS", false, null),
         new Property("IceSSL\\.KeyFile", true, null),
         new Property("IceSSL\\.Keychain", false, null),
         new Property("IceSSL\\.KeychainPassword", false, null),
@@ -1082,6 +1231,10 @@ public final class PropertyNames
         new Property("IceSSL\\.ProtocolVersionMin", false, null),
         new Property("IceSSL\\.Random", false, null),
         new Property("IceSSL\\.SchannelStrongCrypto", false, null),
+        new Property("IceSSL\\.SessionCache", false, null),
+        new Property("IceSSL\\.SessionCacheSize", false, null),
+        new Property("IceSSL\\.SessionTicketKeys", false, null),
+        new Property("IceSSL\\.SessionTimeout", false, null),
         new Property("IceSSL\\.Trace\\.Security", false, null),
         new Property("IceSSL\\.TrustOnly", false, null),
         new Property("IceSSL\\.TrustOnly\\.Client", false, null),
@@ -1147,10 +1300,17 @@ public final class PropertyNames
         new Property("Glacier2\\.Client\\.ThreadPool\\.SizeMax", false, null),
         new Property("Glacier2\\.Client\\.ThreadPool\\.SizeWarn", false, null),
         new Property("Glacier2\\.Client\\.ThreadPool\\.StackSize", false, null),
+        new Property("Glacier2\\.Client\\.ThreadPool\\.Reactors", false, null),
+        new Property("Glacier2\\.Client\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("Glacier2\\.Client\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("Glacier2\\.Client\\.ThreadPool\\.Serialize", false, null),
         new Property("Glacier2\\.Client\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("Glacier2\\.Client\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("Glacier2\\.Client\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("Glacier2\\.Client\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("Glacier2\\.Client\\.MessageSizeMax", false, null),
+        new Property("Glacier2\\.Client\\.DispatchDeadline", false, null),
+        new Property("Glacier2\\.Client\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("Glacier2\\.Client\\.AlwaysBatch", false, null),
         new Property("Glacier2\\.Client\\.Buffered", false, null),
         new Property("Glacier2\\.Client\\.ForwardContext", false, null),
@@ -1222,10 +1382,17 @@ public final class PropertyNames
         new Property("Glacier2\\.Server\\.ThreadPool\\.SizeMax", false, null),
         new Property("Glacier2\\.Server\\.ThreadPool\\.SizeWarn", false, null),
         new Property("Glacier2\\.Server\\.ThreadPool\\.StackSize", false, null),
+        new Property("Glacier2\\.Server\\.ThreadPool\\.Reactors", false, null),
+        new Property("Glacier2\\.Server\\.ThreadPool\\.ExecutorSize", false, null),
+        new Property("Glacier2\\.Server\\.ThreadPool\\.ExecutorDeadline", false, null),
         new Property("Glacier2\\.Server\\.ThreadPool\\.Serialize", false, null),
         new Property("Glacier2\\.Server\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("Glacier2\\.Server\\.ThreadPool\\.ThreadPriority", false, null),
+        new Property("Glacier2\\.Server\\.ThreadPool\\.ThreadAffinity", false, null),
+        new Property("Glacier2\\.Server\\.ThreadPool\\.ReactorAffinity", false, null),
         new Property("Glacier2\\.Server\\.MessageSizeMax", false, null),
+        new Property("Glacier2\\.Server\\.DispatchDeadline", false, null),
+        new Property("Glacier2\\.Server\\.DispatchDeadline\\.[^\\s]+", false, null),
         new Property("Glacier2\\.Server\\.AlwaysBatch", false, null),
         new Property("Glacier2\\.Server\\.Buffered", false, null),
         new Property("Glacier2\\.Server\\.ForwardContext", false, null),
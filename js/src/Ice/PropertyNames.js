@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Tue May 16 17:04:55 2017
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Sat Oct 17 14:20:37 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -64,10 +64,17 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.ThreadPool\.SizeMax/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.SizeWarn/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.StackSize/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.Reactors/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.ExecutorSize/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.ExecutorDeadline/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.Serialize/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadPriority/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.ThreadAffinity/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.ReactorAffinity/", false, null),
     new Property("/^Ice\.Admin\.MessageSizeMax/", false, null),
+    new Property("/^Ice\.Admin\.DispatchDeadline/", false, null),
+    new Property("/^Ice\.Admin\.DispatchDeadline\../", false, null),
     new Property("/^Ice\.Admin\.DelayCreation/", false, null),
     new Property("/^Ice\.Admin\.Enabled/", false, null),
     new Property("/^Ice\.Admin\.Facets/", false, null),
@@ -78,13 +85,21 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.ServerId/", false, null),
     new Property("/^Ice\.BackgroundLocatorCacheUpdates/", false, null),
     new Property("/^Ice\.BatchAutoFlush/", true, null),
+    new Property("/^Ice\.BatchAutoFlushDelay/", false, null),
     new Property("/^Ice\.BatchAutoFlushSize/", false, null),
+    new Property("/^Ice\.BufferPool\.Size/", false, null),
+    new Property("/^Ice\.BufferPool\.ThreadCacheSize/", false, null),
     new Property("/^Ice\.ChangeUser/", false, null),
     new Property("/^Ice\.ClassGraphDepthMax/", false, null),
     new Property("/^Ice\.ClientAccessPolicyProtocol/", false, null),
+    new Property("/^Ice\.Compression\.Adaptive/", false, null),
+    new Property("/^Ice\.Compression\.Codec/", false, null),
     new Property("/^Ice\.Compression\.Level/", false, null),
     new Property("/^Ice\.CollectObjects/", false, null),
+    new Property("/^Ice\.CollocationDirect/", false, null),
     new Property("/^Ice\.Config/", false, null),
+    new Property("/^Ice\.ConnectionPool\.Selection/", false, null),
+    new Property("/^Ice\.ConnectionPool\.Size/", false, null),
     new Property("/^Ice\.ConsoleListener/", false, null),
     new Property("/^Ice\.Default\.CollocationOptimized/", false, null),
     new Property("/^Ice\.Default\.EncodingVersion/", false, null),
@@ -146,6 +161,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.PrintProcessId/", false, null),
     new Property("/^Ice\.PrintStackTraces/", false, null),
     new Property("/^Ice\.ProgramName/", false, null),
+    new Property("/^Ice\.ReadAheadSize/", false, null),
     new Property("/^Ice\.RetryIntervals/", false, null),
     new Property("/^Ice\.ServerIdleTime/", false, null),
     new Property("/^Ice\.SOCKSProxyHost/", false, null),
@@ -157,20 +173,32 @@ PropertyNames.IceProps =
     new Property("/^Ice\.ThreadPool\.Client\.SizeMax/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.SizeWarn/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.StackSize/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.Reactors/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.ExecutorSize/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.ExecutorDeadline/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.ThreadAffinity/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.ReactorAffinity/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.Size/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeMax/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeWarn/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.StackSize/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.Reactors/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.ExecutorSize/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.ExecutorDeadline/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.ThreadAffinity/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.ReactorAffinity/", false, null),
     new Property("/^Ice\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadAffinity/", false, null),
     new Property("/^Ice\.ToStringMode/", false, null),
     new Property("/^Ice\.Trace\.Admin\.Properties/", false, null),
     new Property("/^Ice\.Trace\.Admin\.Logger/", false, null),
+    new Property("/^Ice\.Trace\.BufferPool/", false, null),
     new Property("/^Ice\.Trace\.Locator/", false, null),
     new Property("/^Ice\.Trace\.Network/", false, null),
     new Property("/^Ice\.Trace\.Protocol/", false, null),
@@ -191,6 +219,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Warn\.Endpoints/", false, null),
     new Property("/^Ice\.Warn\.UnknownProperties/", false, null),
     new Property("/^Ice\.Warn\.UnusedProperties/", false, null),
+    new Property("/^Ice\.ZeroCopySize/", false, null),
     new Property("/^Ice\.CacheMessageBuffers/", false, null),
     new Property("/^Ice\.ThreadInterruptSafe/", false, null),
     new Property("/^Ice\.Voip/", false, null),